@@ -0,0 +1,375 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "barrier.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include barrier functionality.  This #if is closed at the very bottom of
+ * this file.  If you want to include barriers then ensure configUSE_BARRIERS is
+ * set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_BARRIERS == 1 )
+
+/* The value written to the event list item of a waiting task when the barrier
+ * releases it, so the task can tell it was released rather than timed out. */
+    #define barrierRELEASED    ( ( EventItemValue_t ) 1U )
+
+    typedef struct BarrierDef_t
+    {
+        UBaseType_t uxParticipants; /**< The number of tasks that must arrive at the barrier before any of them can pass it. */
+        UBaseType_t uxArrived;      /**< The number of tasks that have arrived at the barrier in the current phase. */
+        UBaseType_t uxGeneration;   /**< Incremented each time the barrier releases its participants, so the barrier can be reused for the next phase. */
+        List_t xTasksWaiting;       /**< List of tasks waiting for the remaining participants to arrive. */
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the barrier is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } Barrier_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by the last task to arrive at the barrier.  Starts the next phase and
+ * moves every waiting task to the ready list in a single pass.  Must be called
+ * with the scheduler suspended.
+ */
+    static void prvReleaseBarrier( Barrier_t * const pxBarrier ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        BarrierHandle_t xBarrierCreateStatic( UBaseType_t uxParticipants,
+                                              StaticBarrier_t * pxBarrierBuffer )
+        {
+            Barrier_t * pxBarrier;
+
+            traceENTER_xBarrierCreateStatic( uxParticipants, pxBarrierBuffer );
+
+            configASSERT( uxParticipants > ( UBaseType_t ) 0U );
+
+            /* A StaticBarrier_t object must be provided. */
+            configASSERT( pxBarrierBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticBarrier_t equals the size of the real
+                 * barrier structure. */
+                volatile size_t xSize = sizeof( StaticBarrier_t );
+                configASSERT( xSize == sizeof( Barrier_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            /* The user has provided a statically allocated barrier - use it. */
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxBarrier = ( Barrier_t * ) pxBarrierBuffer;
+
+            if( ( pxBarrier != NULL ) && ( uxParticipants > ( UBaseType_t ) 0U ) )
+            {
+                pxBarrier->uxParticipants = uxParticipants;
+                pxBarrier->uxArrived = ( UBaseType_t ) 0U;
+                pxBarrier->uxGeneration = ( UBaseType_t ) 0U;
+                vListInitialise( &( pxBarrier->xTasksWaiting ) );
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note
+                     * that this barrier was created statically in case the
+                     * barrier is later deleted. */
+                    pxBarrier->ucStaticallyAllocated = pdTRUE;
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+                traceBARRIER_CREATE( pxBarrier );
+            }
+            else
+            {
+                pxBarrier = NULL;
+                traceBARRIER_CREATE_FAILED();
+            }
+
+            traceRETURN_xBarrierCreateStatic( pxBarrier );
+
+            return pxBarrier;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        BarrierHandle_t xBarrierCreate( UBaseType_t uxParticipants )
+        {
+            Barrier_t * pxBarrier = NULL;
+
+            traceENTER_xBarrierCreate( uxParticipants );
+
+            configASSERT( uxParticipants > ( UBaseType_t ) 0U );
+
+            if( uxParticipants > ( UBaseType_t ) 0U )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxBarrier = ( Barrier_t * ) pvPortMalloc( sizeof( Barrier_t ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxBarrier != NULL )
+            {
+                pxBarrier->uxParticipants = uxParticipants;
+                pxBarrier->uxArrived = ( UBaseType_t ) 0U;
+                pxBarrier->uxGeneration = ( UBaseType_t ) 0U;
+                vListInitialise( &( pxBarrier->xTasksWaiting ) );
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note
+                     * this barrier was allocated dynamically in case the barrier
+                     * is later deleted. */
+                    pxBarrier->ucStaticallyAllocated = pdFALSE;
+                }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+                traceBARRIER_CREATE( pxBarrier );
+            }
+            else
+            {
+                traceBARRIER_CREATE_FAILED();
+            }
+
+            traceRETURN_xBarrierCreate( pxBarrier );
+
+            return pxBarrier;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    BaseType_t xBarrierWait( BarrierHandle_t xBarrier,
+                             TickType_t xTicksToWait )
+    {
+        Barrier_t * const pxBarrier = xBarrier;
+        BaseType_t xReturn = pdPASS;
+        BaseType_t xBlocked = pdFALSE;
+        BaseType_t xAlreadyYielded;
+        UBaseType_t uxGeneration;
+
+        traceENTER_xBarrierWait( xBarrier, xTicksToWait );
+
+        configASSERT( pxBarrier );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        vTaskSuspendAll();
+        {
+            uxGeneration = pxBarrier->uxGeneration;
+            pxBarrier->uxArrived++;
+
+            if( pxBarrier->uxArrived >= pxBarrier->uxParticipants )
+            {
+                /* This is the last task to arrive, so it does not block. */
+                prvReleaseBarrier( pxBarrier );
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                /* The other participants have not arrived and no block time
+                 * was specified, so withdraw from the barrier. */
+                pxBarrier->uxArrived--;
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                /* Arriving is O(1) - the task is placed at the end of the
+                 * unordered list of waiting tasks. */
+                traceBARRIER_WAIT_BLOCK( xBarrier );
+                vTaskPlaceOnUnorderedEventList( &( pxBarrier->xTasksWaiting ), ( EventItemValue_t ) 0U, xTicksToWait );
+                xBlocked = pdTRUE;
+            }
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( xBlocked != pdFALSE )
+        {
+            if( xAlreadyYielded == pdFALSE )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The task was either released by the last task to arrive or its
+             * block time expired. */
+            if( ( uxTaskResetEventItemValue() & barrierRELEASED ) == ( EventItemValue_t ) 0U )
+            {
+                vTaskSuspendAll();
+                {
+                    if( pxBarrier->uxGeneration == uxGeneration )
+                    {
+                        /* The phase is still in progress, so withdraw from
+                         * it. */
+                        pxBarrier->uxArrived--;
+                        xReturn = pdFAIL;
+                    }
+                    else
+                    {
+                        /* The remaining participants arrived after the block
+                         * time expired but before this task ran again.  This
+                         * task's arrival was counted, so it has passed the
+                         * barrier. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceBARRIER_WAIT_END( xBarrier, xReturn );
+
+        traceRETURN_xBarrierWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvReleaseBarrier( Barrier_t * const pxBarrier )
+    {
+        const List_t * const pxTasksWaiting = &( pxBarrier->xTasksWaiting );
+
+        traceBARRIER_RELEASE( pxBarrier );
+
+        /* Start the next phase before readying the waiting tasks, so a released
+         * task that arrives at the barrier again is counted in the new phase. */
+        pxBarrier->uxArrived = ( UBaseType_t ) 0U;
+        pxBarrier->uxGeneration++;
+
+        /* The scheduler is suspended, so all the waiting tasks are readied
+         * before any of them run, and only one context switch is required when
+         * the scheduler is resumed. */
+        while( listLIST_IS_EMPTY( pxTasksWaiting ) == pdFALSE )
+        {
+            vTaskRemoveFromUnorderedEventList( listGET_HEAD_ENTRY( pxTasksWaiting ), barrierRELEASED );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vBarrierDelete( BarrierHandle_t xBarrier )
+    {
+        Barrier_t * pxBarrier = xBarrier;
+
+        traceENTER_vBarrierDelete( xBarrier );
+
+        configASSERT( pxBarrier );
+
+        /* Tasks that are waiting would access the barrier when they time out,
+         * so the barrier must not be deleted while tasks are waiting on it. */
+        configASSERT( listLIST_IS_EMPTY( &( pxBarrier->xTasksWaiting ) ) != pdFALSE );
+
+        traceBARRIER_DELETE( xBarrier );
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The barrier can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxBarrier );
+        }
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The barrier could have been allocated statically or dynamically,
+             * so check before attempting to free the memory. */
+            if( pxBarrier->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxBarrier );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        traceRETURN_vBarrierDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxBarrierGetGeneration( BarrierHandle_t xBarrier )
+    {
+        Barrier_t const * const pxBarrier = xBarrier;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxBarrierGetGeneration( xBarrier );
+
+        configASSERT( pxBarrier );
+
+        uxReturn = pxBarrier->uxGeneration;
+
+        traceRETURN_uxBarrierGetGeneration( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include barrier functionality.  If you want to include barriers then
+ * ensure configUSE_BARRIERS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_BARRIERS == 1 */
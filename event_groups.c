@@ -79,6 +79,45 @@
 
 /*-----------------------------------------------------------*/
 
+/* When configUSE_EVENT_GROUPS_DIRECT_ISR is 1 interrupts set bits and unblock
+ * waiting tasks directly, so the event bits and the list of waiting tasks are
+ * also protected by a critical section, in addition to the scheduler lock, when
+ * they are accessed from a task. */
+    #if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 )
+        #define eventLOCK_WAITING_TASKS()      taskENTER_CRITICAL()
+        #define eventUNLOCK_WAITING_TASKS()    taskEXIT_CRITICAL()
+    #else
+        #define eventLOCK_WAITING_TASKS()
+        #define eventUNLOCK_WAITING_TASKS()
+    #endif
+
+/* Obtain the bits, and the control bits, a task that is in the list of waiting
+ * tasks is waiting for.  They are too wide for the value of the task's event
+ * list item when configUSE_64_BIT_EVENT_GROUPS is 1 and TickType_t is narrower,
+ * so are held by the task instead. */
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+        #define eventGET_BITS_WAITED_FOR( pxListItem )    uxTaskGetEventItemValue( pxListItem )
+    #else
+        #define eventGET_BITS_WAITED_FOR( pxListItem )    listGET_LIST_ITEM_VALUE( pxListItem )
+    #endif
+
+/* A pended function call only carries 32 bits, so when event groups are 64 bits
+ * wide the bits an interrupt sets or clears through the daemon task are held in
+ * a request slot, and the pended call carries the index of the slot.  A slot is
+ * in use from the time it is allocated until the daemon task executes the
+ * request, which is at most one more than the number of commands the timer
+ * queue can hold, so a slot is always free when the request can be queued. */
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configUSE_EVENT_GROUPS_DIRECT_ISR == 0 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+        #define eventUSE_PENDED_REQUESTS     1
+        #define eventPENDED_REQUEST_SLOTS    ( ( uint32_t ) configTIMER_QUEUE_LENGTH + 1U )
+        #define eventPENDED_REQUEST_IN_USE   eventEVENT_BITS_CONTROL_BYTES
+        #define eventNO_PENDED_REQUEST       eventPENDED_REQUEST_SLOTS
+    #else
+        #define eventUSE_PENDED_REQUESTS     0
+    #endif
+
+/*-----------------------------------------------------------*/
+
 /*
  * Test the bits set in uxCurrentEventBits to see if the wait condition is met.
  * The wait condition is defined by xWaitForAllBits.  If xWaitForAllBits is
@@ -91,6 +130,28 @@
                                             const EventBits_t uxBitsToWaitFor,
                                             const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+    #if ( eventUSE_PENDED_REQUESTS == 1 )
+
+/*
+ * Pend a call to pxCallback to set or clear uxBits in xEventGroup from the
+ * daemon task.  Returns pdFAIL if the timer command queue is full.
+ */
+        static BaseType_t prvPendRequest( PendedFunction_t pxCallback,
+                                          EventGroupHandle_t xEventGroup,
+                                          const EventBits_t uxBits,
+                                          BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the bits held in a request slot, and free the slot.  Called by the
+ * daemon task.
+ */
+        static EventBits_t prvTakePendedRequest( uint32_t ulRequest ) PRIVILEGED_FUNCTION;
+
+/* The bits of each pended request, or 0 if the slot is free. */
+        PRIVILEGED_DATA static EventBits_t uxPendedRequests[ eventPENDED_REQUEST_SLOTS ] = { 0U };
+
+    #endif /* eventUSE_PENDED_REQUESTS */
+
 /*-----------------------------------------------------------*/
 
     /** 仅当设备支持静态分配内存空间时，允许调用 xEventGroupCreateStatic 函数创建静态事件组
@@ -315,6 +376,16 @@
 
             ( void ) xEventGroupSetBits( xEventGroup, uxBitsToSet );
 
+            eventLOCK_WAITING_TASKS();
+
+            #if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 )
+            {
+                /* Include any bits an interrupt has set since the bits were set
+                 * above, as the interrupt will not have seen this task waiting. */
+                uxOriginalBitValue |= pxEventBits->uxEventBits;
+            }
+            #endif
+
             /**
              * uxOriginalBitValue：事件组 xEventGroup 在调用 xEventGroupSetBits 函数之前的原始事件组位
              * uxBitsToSet：当前要设置的事件组位
@@ -379,6 +450,8 @@
                     xTimeoutOccurred = pdTRUE;
                 }
             }
+
+            eventUNLOCK_WAITING_TASKS();
         }
         /** vTaskSuspendAll 会增加调度器挂起计数，xTaskResumeAll 会减少计数，当计数回到 0 时，调度器恢复活动状态。
          *  当挂起计数为 0 时，xTaskResumeAll 会返回 pdFALSE ，此时需立即通过 taskYIELD_WITHIN_API() 强制触发一次调度，因为此时可能已经有更高等级的任务在等待运行
@@ -524,6 +597,7 @@
         #endif
 
         vTaskSuspendAll();
+        eventLOCK_WAITING_TASKS();
         {
             const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -596,6 +670,7 @@
                 traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
             }
         }
+        eventUNLOCK_WAITING_TASKS();
         xAlreadyYielded = xTaskResumeAll();
 
         if( xTicksToWait != ( TickType_t ) 0 )
@@ -714,7 +789,40 @@
     }
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 )
+
+        BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
+                                                const EventBits_t uxBitsToClear )
+        {
+            EventGroup_t * pxEventBits = xEventGroup;
+            UBaseType_t uxSavedInterruptStatus;
+
+            traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear );
+
+            /* Check the user is not attempting to clear the bits used by the
+             * kernel itself. */
+            configASSERT( xEventGroup );
+            configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+            /* Clearing bits cannot unblock a task, so the bits are cleared
+             * directly rather than by the timer task. */
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+
+                pxEventBits->uxEventBits &= ~uxBitsToClear;
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            traceRETURN_xEventGroupClearBitsFromISR( pdPASS );
+
+            return pdPASS;
+        }
+
+    #elif ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                                 const EventBits_t uxBitsToClear )
@@ -724,14 +832,23 @@
             traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear );
 
             traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
-            xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL );
+
+            #if ( eventUSE_PENDED_REQUESTS == 1 )
+            {
+                xReturn = prvPendRequest( vEventGroupClearPendedBitsCallback, xEventGroup, uxBitsToClear, NULL );
+            }
+            #else
+            {
+                xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL );
+            }
+            #endif /* eventUSE_PENDED_REQUESTS */
 
             traceRETURN_xEventGroupClearBitsFromISR( xReturn );
 
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) */
 /*-----------------------------------------------------------*/
 
     /**
@@ -795,6 +912,7 @@
         //得到尾节点，但不能通过 pxListEnd 修改尾节点的参数
         pxListEnd = listGET_END_MARKER( pxList );
         vTaskSuspendAll();
+        eventLOCK_WAITING_TASKS();
         {
             traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
@@ -807,7 +925,7 @@
             while( pxListItem != pxListEnd )
             {
                 pxNext = listGET_NEXT( pxListItem );
-                uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+                uxBitsWaitedFor = eventGET_BITS_WAITED_FOR( pxListItem );
                 xMatchFound = pdFALSE;
 
                 /* Split the bits waited for from the control bits. */
@@ -872,6 +990,7 @@
             /* Snapshot resulting bits. */
             uxReturnBits = pxEventBits->uxEventBits;
         }
+        eventUNLOCK_WAITING_TASKS();
         ( void ) xTaskResumeAll();
 
         traceRETURN_xEventGroupSetBits( uxReturnBits );
@@ -901,6 +1020,7 @@
          * 其中，释放内存是优先级较低的工作，而是个“原子”操作，需要暂停其他所有任务的调度，保证其能够持续执行
          * */
         vTaskSuspendAll();
+        eventLOCK_WAITING_TASKS();
         {
             traceEVENT_GROUP_DELETE( xEventGroup );
 
@@ -920,6 +1040,7 @@
                 vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
             }
         }
+        eventUNLOCK_WAITING_TASKS();
         ( void ) xTaskResumeAll();
 
         /** 
@@ -1048,6 +1169,135 @@
     }
 /*-----------------------------------------------------------*/
 
+    #if ( eventUSE_PENDED_REQUESTS == 1 )
+
+/* For internal use only - execute a 'set bits' command held in a request slot
+ * that was pended from an interrupt. */
+        void vEventGroupSetPendedBitsCallback( void * pvEventGroup,
+                                               uint32_t ulRequest )
+        {
+            traceENTER_vEventGroupSetPendedBitsCallback( pvEventGroup, ulRequest );
+
+            /* MISRA Ref 11.5.4 [Callback function parameter] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            ( void ) xEventGroupSetBits( pvEventGroup, prvTakePendedRequest( ulRequest ) );
+
+            traceRETURN_vEventGroupSetPendedBitsCallback();
+        }
+
+    #endif /* eventUSE_PENDED_REQUESTS */
+/*-----------------------------------------------------------*/
+
+    #if ( eventUSE_PENDED_REQUESTS == 1 )
+
+/* For internal use only - execute a 'clear bits' command held in a request
+ * slot that was pended from an interrupt. */
+        void vEventGroupClearPendedBitsCallback( void * pvEventGroup,
+                                                 uint32_t ulRequest )
+        {
+            traceENTER_vEventGroupClearPendedBitsCallback( pvEventGroup, ulRequest );
+
+            /* MISRA Ref 11.5.4 [Callback function parameter] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            ( void ) xEventGroupClearBits( pvEventGroup, prvTakePendedRequest( ulRequest ) );
+
+            traceRETURN_vEventGroupClearPendedBitsCallback();
+        }
+
+    #endif /* eventUSE_PENDED_REQUESTS */
+/*-----------------------------------------------------------*/
+
+    #if ( eventUSE_PENDED_REQUESTS == 1 )
+
+        static BaseType_t prvPendRequest( PendedFunction_t pxCallback,
+                                          EventGroupHandle_t xEventGroup,
+                                          const EventBits_t uxBits,
+                                          BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            BaseType_t xReturn = pdFAIL;
+            UBaseType_t uxSavedInterruptStatus;
+            uint32_t ulRequest;
+
+            /* Find a free slot, and mark it as in use, in a critical section
+             * as a higher priority interrupt may also pend a request. */
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                for( ulRequest = 0U; ulRequest < eventPENDED_REQUEST_SLOTS; ulRequest++ )
+                {
+                    if( uxPendedRequests[ ulRequest ] == ( EventBits_t ) 0U )
+                    {
+                        uxPendedRequests[ ulRequest ] = ( uxBits & ~eventPENDED_REQUEST_IN_USE ) | eventPENDED_REQUEST_IN_USE;
+                        break;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            if( ulRequest != eventNO_PENDED_REQUEST )
+            {
+                xReturn = xTimerPendFunctionCallFromISR( pxCallback, ( void * ) xEventGroup, ulRequest, pxHigherPriorityTaskWoken );
+
+                if( xReturn == pdFAIL )
+                {
+                    /* The request was not queued, so none of its bits are set
+                     * or cleared.  Free the slot again. */
+                    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                    /* coverity[misra_c_2012_directive_4_7_violation] */
+                    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                    {
+                        uxPendedRequests[ ulRequest ] = ( EventBits_t ) 0U;
+                    }
+                    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReturn;
+        }
+
+    #endif /* eventUSE_PENDED_REQUESTS */
+/*-----------------------------------------------------------*/
+
+    #if ( eventUSE_PENDED_REQUESTS == 1 )
+
+        static EventBits_t prvTakePendedRequest( uint32_t ulRequest )
+        {
+            EventBits_t uxBits;
+
+            configASSERT( ulRequest < eventPENDED_REQUEST_SLOTS );
+
+            /* A 64-bit slot may take more than one access, and interrupts
+             * search the slots, so it is only accessed in a critical section. */
+            taskENTER_CRITICAL();
+            {
+                uxBits = uxPendedRequests[ ulRequest ] & ~eventPENDED_REQUEST_IN_USE;
+                uxPendedRequests[ ulRequest ] = ( EventBits_t ) 0U;
+            }
+            taskEXIT_CRITICAL();
+
+            return uxBits;
+        }
+
+    #endif /* eventUSE_PENDED_REQUESTS */
+/*-----------------------------------------------------------*/
+
     /**
      * prv:private，对应 static 修饰符
      * 若 xWaitForAllBits 为真，返回 uxCurrentEventBits 和 uxBitsToWaitFor 的 bit 1 是否完全一致
@@ -1096,7 +1346,105 @@
      * ，以及调用回调 vEventGroupSetBitsCallback 实现设置bit位
      * 在核心两个函数的基础上做了一层简单封装
      * */
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 )
+
+        BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
+                                              const EventBits_t uxBitsToSet,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            ListItem_t * pxListItem;
+            ListItem_t * pxNext;
+            ListItem_t const * pxListEnd;
+            EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+            EventGroup_t * pxEventBits = xEventGroup;
+            UBaseType_t uxSavedInterruptStatus;
+            BaseType_t xWaitForAllBits;
+
+            traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
+
+            /* Check the user is not attempting to set the bits used by the kernel
+             * itself. */
+            configASSERT( xEventGroup );
+            configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+
+            pxListEnd = listGET_END_MARKER( &( pxEventBits->xTasksWaitingForBits ) );
+
+            /* Tasks only access the bits and the list of waiting tasks from
+             * within a critical section, so the bits can be set, and any tasks
+             * they unblock removed from the list, here rather than in the timer
+             * task.  The time spent in the critical section is bounded by the
+             * number of tasks waiting on this event group. */
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+                pxEventBits->uxEventBits |= uxBitsToSet;
+
+                pxListItem = listGET_HEAD_ENTRY( &( pxEventBits->xTasksWaitingForBits ) );
+
+                while( pxListItem != pxListEnd )
+                {
+                    pxNext = listGET_NEXT( pxListItem );
+                    uxBitsWaitedFor = eventGET_BITS_WAITED_FOR( pxListItem );
+
+                    /* Split the bits waited for from the control bits. */
+                    uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+                    uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+                    xWaitForAllBits = ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE;
+
+                    if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, xWaitForAllBits ) != pdFALSE )
+                    {
+                        if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+                        {
+                            uxBitsToClear |= uxBitsWaitedFor;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        /* Unblock the task, or hold it pending if the scheduler
+                         * is suspended, passing it the event bits as
+                         * xEventGroupSetBits() does. */
+                        if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET ) != pdFALSE )
+                        {
+                            if( pxHigherPriorityTaskWoken != NULL )
+                            {
+                                *pxHigherPriorityTaskWoken = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxListItem = pxNext;
+                }
+
+                /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+                 * bit was set in the control word. */
+                pxEventBits->uxEventBits &= ~uxBitsToClear;
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+            traceRETURN_xEventGroupSetBitsFromISR( pdPASS );
+
+            return pdPASS;
+        }
+
+    #elif ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         /**
          * pxHigherPriorityTaskWoken 传递是否有更高优先级的任务因为本次入队操作而被唤醒的信息
@@ -1129,14 +1477,22 @@
             /** 
              * xTimerPendFunctionCallFromISR 函数的核心为：通过 xQueueSendFromISR 函数 将 目标回调函数 vEventGroupSetBitsCallback 、传递给回调函数的两个参数 xEventGroup 和 uxBitsToSet 写入到时间队列 xTimerQueue 中
              * */
-            xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+            #if ( eventUSE_PENDED_REQUESTS == 1 )
+            {
+                xReturn = prvPendRequest( vEventGroupSetPendedBitsCallback, xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
+            }
+            #else
+            {
+                xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+            }
+            #endif /* eventUSE_PENDED_REQUESTS */
 
             traceRETURN_xEventGroupSetBitsFromISR( xReturn );
 
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) */
 /*-----------------------------------------------------------*/
 
     #if ( configUSE_TRACE_FACILITY == 1 )
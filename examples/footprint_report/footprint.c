@@ -0,0 +1,152 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Records the RAM used by each type of kernel object, and the RAM each
+ * configuration option adds, as the sizes of constant arrays.  The object file
+ * is never linked.  footprint_report.cmake reads the sizes back with nm, so the
+ * report is produced at build time with any toolchain, including cross
+ * compilers.  The sizes added by configuration options are the sizes of the
+ * members concerned before padding, so the total RAM of an object can differ
+ * from their sum.
+ */
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <timers.h>
+
+/*-----------------------------------------------------------*/
+
+/* RAM used by one object of each type, excluding task stacks and queue and
+ * stream buffer storage. */
+#define footprintOBJECT( xName, xBytes )    const uint8_t ucFootprintObject_##xName[ ( xBytes ) ] = { 0U }
+
+/* RAM added to each task, or to each queue, semaphore or mutex, by an option. */
+#define footprintTASK( xOption, xBytes )    const uint8_t ucFootprintTask_##xOption[ ( xBytes ) ] = { 0U }
+#define footprintQUEUE( xOption, xBytes )   const uint8_t ucFootprintQueue_##xOption[ ( xBytes ) ] = { 0U }
+
+/* RAM used once by the kernel because of an option. */
+#define footprintKERNEL( xOption, xBytes )  const uint8_t ucFootprintKernel_##xOption[ ( xBytes ) ] = { 0U }
+
+/*-----------------------------------------------------------*/
+
+footprintOBJECT( Task, sizeof( StaticTask_t ) );
+footprintOBJECT( QueueSemaphoreMutex, sizeof( StaticQueue_t ) );
+
+#if ( configUSE_EVENT_GROUPS == 1 )
+    footprintOBJECT( EventGroup, sizeof( StaticEventGroup_t ) );
+#endif
+
+#if ( configUSE_STREAM_BUFFERS == 1 )
+    footprintOBJECT( StreamOrMessageBuffer, sizeof( StaticStreamBuffer_t ) );
+#endif
+
+#if ( configUSE_TIMERS == 1 )
+    footprintOBJECT( Timer, sizeof( StaticTimer_t ) );
+#endif
+
+#if ( configUSE_BARRIERS == 1 )
+    footprintOBJECT( Barrier, sizeof( StaticBarrier_t ) );
+#endif
+
+/*-----------------------------------------------------------*/
+
+footprintTASK( configMAX_TASK_NAME_LEN, configMAX_TASK_NAME_LEN );
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    footprintTASK( configTASK_NOTIFICATION_ARRAY_ENTRIES, ( sizeof( uint32_t ) + sizeof( uint8_t ) ) * configTASK_NOTIFICATION_ARRAY_ENTRIES );
+#endif
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+    footprintTASK( configNUM_THREAD_LOCAL_STORAGE_POINTERS, sizeof( void * ) * configNUM_THREAD_LOCAL_STORAGE_POINTERS );
+#endif
+
+#if ( configUSE_MUTEXES == 1 )
+    #if ( configUSE_COMPACT_TCB == 1 )
+        footprintTASK( configUSE_MUTEXES, 2U * sizeof( uint8_t ) );
+    #else
+        footprintTASK( configUSE_MUTEXES, 2U * sizeof( UBaseType_t ) );
+    #endif
+#endif
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+    footprintTASK( configUSE_TRACE_FACILITY, 2U * sizeof( UBaseType_t ) );
+    footprintQUEUE( configUSE_TRACE_FACILITY, sizeof( UBaseType_t ) + sizeof( uint8_t ) );
+#endif
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+    footprintTASK( configUSE_APPLICATION_TASK_TAG, sizeof( TaskHookFunction_t ) );
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    footprintTASK( configGENERATE_RUN_TIME_STATS, sizeof( configRUN_TIME_COUNTER_TYPE ) );
+#endif
+
+#if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+    footprintTASK( configUSE_C_RUNTIME_TLS_SUPPORT, sizeof( configTLS_BLOCK_TYPE ) );
+#endif
+
+#if ( ( portSTACK_GROWTH < 0 ) && ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+    footprintTASK( configRECORD_STACK_HIGH_ADDRESS, sizeof( void * ) );
+#endif
+
+#if ( configUSE_POSIX_ERRNO == 1 )
+    footprintTASK( configUSE_POSIX_ERRNO, sizeof( int ) );
+#endif
+
+#if ( configUSE_QUEUE_SETS == 1 )
+    footprintQUEUE( configUSE_QUEUE_SETS, sizeof( void * ) );
+#endif
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+    footprintQUEUE( configUSE_PRIORITY_QUEUES, sizeof( void * ) );
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* The ready lists, one per priority. */
+footprintKERNEL( configMAX_PRIORITIES, sizeof( List_t ) * configMAX_PRIORITIES );
+
+/* The TCBs and stacks of the idle tasks, one per core, whether they are
+ * allocated by the application or from the heap. */
+footprintKERNEL( configMINIMAL_STACK_SIZE, ( sizeof( StaticTask_t ) + ( sizeof( StackType_t ) * configMINIMAL_STACK_SIZE ) ) * configNUMBER_OF_CORES );
+
+#if ( configUSE_TIMERS == 1 )
+
+/* The TCB and stack of the timer task and the timer command queue, excluding
+ * the storage of the queue. */
+    footprintKERNEL( configTIMER_TASK_STACK_DEPTH, sizeof( StaticTask_t ) + ( sizeof( StackType_t ) * configTIMER_TASK_STACK_DEPTH ) + sizeof( StaticQueue_t ) );
+#endif
+
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && defined( configTOTAL_HEAP_SIZE ) )
+
+/* The heap array of heap_1.c, heap_2.c and heap_4.c. */
+    footprintKERNEL( configTOTAL_HEAP_SIZE, configTOTAL_HEAP_SIZE );
+#endif
@@ -0,0 +1,183 @@
+# Prints the RAM and ROM used by the FreeRTOS kernel, per source file, per
+# kernel variable, per type of kernel object and per configuration option.
+#
+# Run by the footprint_report target of CMakeLists.txt in this directory as:
+#
+#   cmake -DNM=<nm> -DKERNEL_LIBRARY=<library> -DFOOTPRINT_OBJECTS=<objects>
+#         [-DSIZE=<size>] [-DREPORT_FILE=<file>] -P footprint_report.cmake
+#
+# NM and SIZE must be the binutils programs of the toolchain that built the
+# kernel.  Without SIZE, the ROM and RAM per source file are summed from the
+# sizes of the symbols, which omits unnamed data such as string literals.
+
+if(NOT NM OR NOT KERNEL_LIBRARY OR NOT FOOTPRINT_OBJECTS)
+    message(FATAL_ERROR "NM, KERNEL_LIBRARY and FOOTPRINT_OBJECTS must be set.")
+endif()
+
+set(report "")
+
+# Appends a line to the report with the value right aligned in a column.
+function(footprint_line name value)
+    string(LENGTH "${name}" length)
+    math(EXPR padding "48 - ${length}")
+    if(padding LESS 1)
+        set(padding 1)
+    endif()
+    string(REPEAT " " ${padding} spaces)
+    set(report "${report}  ${name}${spaces}${value}\n" PARENT_SCOPE)
+endfunction()
+
+# Appends a line to the report with a ROM and a RAM column.
+function(footprint_rom_ram_line name rom ram)
+    string(LENGTH "${rom}" length)
+    math(EXPR padding "10 - ${length}")
+    if(padding LESS 1)
+        set(padding 1)
+    endif()
+    string(REPEAT " " ${padding} spaces)
+    footprint_line("${name}" "${rom}${spaces}${ram}")
+    set(report "${report}" PARENT_SCOPE)
+endfunction()
+
+function(footprint_heading title)
+    set(report "${report}\n${title}\n" PARENT_SCOPE)
+endfunction()
+
+function(footprint_run output_variable)
+    execute_process(COMMAND ${ARGN}
+                    OUTPUT_VARIABLE output
+                    RESULT_VARIABLE result
+                    ERROR_QUIET)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to run ${ARGN}")
+    endif()
+    string(REPLACE ";" "," output "${output}")
+    string(REPLACE "\n" ";" output "${output}")
+    set(${output_variable} "${output}" PARENT_SCOPE)
+endfunction()
+
+########################################################################
+# The sizes recorded by footprint.c.
+
+footprint_run(lines ${NM} --print-size ${FOOTPRINT_OBJECTS})
+
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [A-Za-z] ucFootprint(Object|Task|Queue|Kernel)_(.+)$")
+        math(EXPR bytes "0x${CMAKE_MATCH_1}")
+        list(APPEND footprint_${CMAKE_MATCH_2} "${CMAKE_MATCH_3}" "${bytes}")
+    endif()
+endforeach()
+
+set(footprint_titles_Object "RAM per kernel object, excluding stacks and buffers (bytes)")
+set(footprint_titles_Task "RAM added to each task by option, before padding (bytes)")
+set(footprint_titles_Queue "RAM added to each queue, semaphore and mutex by option, before padding (bytes)")
+set(footprint_titles_Kernel "RAM used once by the kernel by option (bytes)")
+
+foreach(group Object Task Queue Kernel)
+    if(footprint_${group})
+        footprint_heading("${footprint_titles_${group}}")
+        list(LENGTH footprint_${group} count)
+        math(EXPR last "${count} - 1")
+        foreach(index RANGE 0 ${last} 2)
+            math(EXPR value_index "${index} + 1")
+            list(GET footprint_${group} ${index} name)
+            list(GET footprint_${group} ${value_index} bytes)
+            footprint_line("${name}" "${bytes}")
+        endforeach()
+    endif()
+endforeach()
+
+########################################################################
+# The RAM and ROM of each kernel source file.
+
+footprint_heading("ROM and RAM per kernel source file (bytes)")
+footprint_rom_ram_line("" "ROM" "RAM")
+
+set(total_rom 0)
+set(total_ram 0)
+
+if(SIZE)
+    footprint_run(lines ${SIZE} ${KERNEL_LIBRARY})
+
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^[ \t]*([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9a-fA-F]+[ \t]+([^ \t]+)")
+            math(EXPR rom "${CMAKE_MATCH_1} + ${CMAKE_MATCH_2}")
+            math(EXPR ram "${CMAKE_MATCH_2} + ${CMAKE_MATCH_3}")
+            string(REGEX REPLACE "\\.(o|obj)$" "" module "${CMAKE_MATCH_4}")
+
+            # Skip the source files that the configuration excludes.
+            if(rom GREATER 0 OR ram GREATER 0)
+                math(EXPR total_rom "${total_rom} + ${rom}")
+                math(EXPR total_ram "${total_ram} + ${ram}")
+                footprint_rom_ram_line("${module}" "${rom}" "${ram}")
+            endif()
+        endif()
+    endforeach()
+endif()
+
+footprint_run(lines ${NM} --print-size --size-sort ${KERNEL_LIBRARY})
+
+set(module "")
+set(modules "")
+
+foreach(line IN LISTS lines)
+    if(line MATCHES "^(.+)\\.(o|obj):$")
+        set(module "${CMAKE_MATCH_1}")
+        list(APPEND modules "${module}")
+        set(rom_${module} 0)
+        set(ram_${module} 0)
+        set(variables_${module} "")
+    elseif(line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) ([A-Za-z]) (.+)$")
+        math(EXPR bytes "0x${CMAKE_MATCH_1}")
+        set(type "${CMAKE_MATCH_2}")
+        set(name "${CMAKE_MATCH_3}")
+
+        if(type MATCHES "[TtRrWw]")
+            math(EXPR rom_${module} "${rom_${module}} + ${bytes}")
+        elseif(type MATCHES "[DdGg]")
+            math(EXPR rom_${module} "${rom_${module}} + ${bytes}")
+            math(EXPR ram_${module} "${ram_${module}} + ${bytes}")
+            list(APPEND variables_${module} "${name}" "${bytes}")
+        elseif(type MATCHES "[BbSsCc]")
+            math(EXPR ram_${module} "${ram_${module}} + ${bytes}")
+            list(APPEND variables_${module} "${name}" "${bytes}")
+        endif()
+    endif()
+endforeach()
+
+if(NOT SIZE)
+    foreach(module IN LISTS modules)
+        if(rom_${module} GREATER 0 OR ram_${module} GREATER 0)
+            math(EXPR total_rom "${total_rom} + ${rom_${module}}")
+            math(EXPR total_ram "${total_ram} + ${ram_${module}}")
+            footprint_rom_ram_line("${module}" "${rom_${module}}" "${ram_${module}}")
+        endif()
+    endforeach()
+endif()
+
+footprint_rom_ram_line("Total" "${total_rom}" "${total_ram}")
+
+########################################################################
+# The kernel variables, largest first within each source file.
+
+footprint_heading("RAM per kernel variable (bytes)")
+
+foreach(module IN LISTS modules)
+    if(variables_${module})
+        list(LENGTH variables_${module} count)
+        math(EXPR index "${count} - 2")
+        while(index GREATER_EQUAL 0)
+            math(EXPR value_index "${index} + 1")
+            list(GET variables_${module} ${index} name)
+            list(GET variables_${module} ${value_index} bytes)
+            footprint_line("${module}: ${name}" "${bytes}")
+            math(EXPR index "${index} - 2")
+        endwhile()
+    endif()
+endforeach()
+
+message("${report}")
+
+if(REPORT_FILE)
+    file(WRITE "${REPORT_FILE}" "${report}")
+endif()
@@ -91,6 +91,31 @@
  * https://freertos.org/single-core-amp-smp-rtos-scheduling.html. */
 #define configUSE_TIME_SLICING                     0
 
+/* Set configUSE_TIME_SLICE_LENGTH to 1 to allow the number of ticks between
+ * time slices to be set for each task using vTaskTimeSliceSet(), rather than
+ * switching between Ready state tasks of equal priority on every tick.  Tasks
+ * start with a time slice of configDEFAULT_TIME_SLICE_LENGTH ticks, and start a
+ * full time slice again each time they block.  Requires configUSE_TIME_SLICING
+ * to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_TIME_SLICE_LENGTH                0
+#define configDEFAULT_TIME_SLICE_LENGTH            1
+
+/* Set configUSE_FAIR_SHARE_SCHEDULING to 1 to schedule the Ready state tasks
+ * at priority configFAIR_SHARE_PRIORITY by the processor time each has used
+ * relative to its weight, rather than round robin.  See
+ * vTaskFairShareWeightSet().  Requires configGENERATE_RUN_TIME_STATS to be 1,
+ * and is not supported in SMP FreeRTOS.  The ready list of that priority is
+ * kept sorted, so making a task at configFAIR_SHARE_PRIORITY ready takes time
+ * proportional to the number of tasks already ready at that priority - at worst
+ * two passes over them, within a critical section, and also when the task is
+ * made ready from an interrupt.  configFAIR_SHARE_MAX_READY_TASKS bounds that
+ * time: configASSERT() fails if more tasks than that are ready at
+ * configFAIR_SHARE_PRIORITY at once.  configUSE_FAIR_SHARE_SCHEDULING defaults
+ * to 0 and configFAIR_SHARE_MAX_READY_TASKS to 8 if left undefined. */
+#define configUSE_FAIR_SHARE_SCHEDULING            0
+#define configFAIR_SHARE_PRIORITY                  1
+#define configFAIR_SHARE_MAX_READY_TASKS           8
+
 /* Set configUSE_PORT_OPTIMISED_TASK_SELECTION to 1 to select the next task to
  * run using an algorithm optimised to the instruction set of the target
  * hardware - normally using a count leading zeros assembly instruction.  Set to
@@ -174,6 +199,17 @@
  * optimization. Defaults to 1 if left undefined. */
 #define configUSE_MINI_LIST_ITEM                   1
 
+/* Set configUSE_COMPACT_TCB to 1 to store the priority, base priority and
+ * mutex count of each task, and in SMP FreeRTOS the run state and attributes
+ * of each task, in single bytes grouped after the task name, instead of in one
+ * word each.  This saves up to 8 bytes per task on a 32-bit architecture, but
+ * moves the task name and the stack pointer within the TCB, so kernel aware
+ * debuggers that use fixed offsets into the TCB may not show tasks correctly.
+ * Requires configMAX_PRIORITIES to be no more than 256.  Defaults to 0 if left
+ * undefined.  See examples/footprint_report to measure the RAM used by each
+ * task and each other kernel object. */
+#define configUSE_COMPACT_TCB                      0
+
 /* Sets the type used by the parameter to xTaskCreate() that specifies the stack
  * size of the task being created.  The same type is used to return information
  * about stack usage in various other API calls.  Defaults to size_t if left
@@ -187,6 +223,14 @@
  * uint8_t. */
 #define configMESSAGE_BUFFER_LENGTH_TYPE           size_t
 
+/* configMESSAGE_BUFFER_ALIGNMENT pads each message buffer record (the length
+ * and the message itself) to a multiple of this many bytes, so every message
+ * starts at an aligned offset and can be copied with aligned accesses.  Must be
+ * a power of two.  Statically allocated message buffers must then use a storage
+ * area that is aligned to, and a multiple of, this value.  Defaults to 1 (no
+ * padding) if left undefined. */
+#define configMESSAGE_BUFFER_ALIGNMENT             1
+
 /* If configHEAP_CLEAR_MEMORY_ON_FREE is set to 1, then blocks of memory
  * allocated using pvPortMalloc() will be cleared (i.e. set to zero) when freed
  * using vPortFree(). Defaults to 0 if left undefined. */
@@ -251,7 +295,33 @@
  * FreeRTOS/source/event_groups.c source file must be included in the build if
  * configUSE_EVENT_GROUPS is set to 1. Defaults to 1 if left undefined. */
 
-#define configUSE_EVENT_GROUPS    1
+#define configUSE_EVENT_GROUPS               1
+
+/* By default event groups hold as many bits as TickType_t, with the top 8 bits
+ * reserved for use by the kernel - so an event group only has 24 bits available
+ * to the application when TickType_t is 32-bits.  Set
+ * configUSE_64_BIT_EVENT_GROUPS to 1 to make EventBits_t 64-bits, providing 56
+ * bits to the application whatever the width of TickType_t.  Unless
+ * configUSE_EVENT_GROUPS_DIRECT_ISR is 1, the bits set or cleared from an
+ * interrupt are then held in one of ( configTIMER_QUEUE_LENGTH + 1 ) static
+ * request slots until the timer task executes the request.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_64_BIT_EVENT_GROUPS        0
+
+/* By default xEventGroupSetBitsFromISR() defers setting the bits to the timer
+ * task.  Set configUSE_EVENT_GROUPS_DIRECT_ISR to 1 to set the bits, and ready
+ * any tasks waiting for them, within the interrupt instead.  Event groups then
+ * use critical sections, held for a time proportional to the number of tasks
+ * waiting on the event group.  Defaults to 0 if left undefined. */
+#define configUSE_EVENT_GROUPS_DIRECT_ISR    0
+
+/* Set configUSE_BARRIERS to 1 to include barrier functionality in the build.
+ * A barrier blocks each of a fixed number of tasks until all of them have
+ * reached it, then releases them together.  The FreeRTOS/source/barrier.c
+ * source file must be included in the build if configUSE_BARRIERS is set to 1.
+ * Barriers are not available when the MPU wrappers are used.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_BARRIERS                   0
 
 /******************************************************************************/
 /* Stream Buffer related definitions. *****************************************/
@@ -364,6 +434,24 @@
  * 0 if left undefined. */
 #define configCHECK_FOR_STACK_OVERFLOW        2
 
+/* Set configUSE_DEADLOCK_DETECTION to 1 to have the idle task check, every
+ * configDEADLOCK_DETECTION_PERIOD ticks, for tasks that are deadlocked waiting
+ * for mutexes held by each other, and for tasks that have waited for longer
+ * than the limit set by vTaskSetBlockTimeLimit().  The application writer must
+ * provide vApplicationDeadlockHook(), which receives the chain of tasks and
+ * mutexes involved, up to configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH tasks long.
+ * The chain is held in a static array of that many TaskWaitLink_t structures,
+ * so it does not use stack.  The hook is called from the idle task with the
+ * scheduler suspended, so configMINIMAL_STACK_SIZE must allow for the stack the
+ * hook uses, and the hook must not block.  Set configDEADLOCK_DETECTION_PERIOD
+ * to 0 to call vTaskCheckForDeadlocks() from the application instead.
+ * configUSE_DEADLOCK_DETECTION defaults to 0, configDEADLOCK_DETECTION_PERIOD
+ * to configTICK_RATE_HZ and configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH to 8 if
+ * left undefined. */
+#define configUSE_DEADLOCK_DETECTION                 0
+#define configDEADLOCK_DETECTION_PERIOD              configTICK_RATE_HZ
+#define configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH    8
+
 /******************************************************************************/
 /* Run time and task stats gathering related definitions. *********************/
 /******************************************************************************/
@@ -388,6 +476,26 @@
  * undefined. */
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Set configUSE_KERNEL_SNAPSHOT to 1 to include xTaskWriteSnapshot(), which
+ * copies the kernel state into a buffer without taking any locks, so it can be
+ * called from a fault handler to preserve the state for analysis after a reset.
+ * Stacks are only included if configRECORD_STACK_HIGH_ADDRESS is 1 or stacks
+ * grow upwards, and queues are only included if they are in the queue registry.
+ * Set configKERNEL_SNAPSHOT_INCLUDE_HEAP to 1 to also include the heap's free
+ * block list, which is only supported by heap_4.c and heap_5.c.  Both default
+ * to 0 if left undefined. */
+#define configUSE_KERNEL_SNAPSHOT               0
+#define configKERNEL_SNAPSHOT_INCLUDE_HEAP      0
+
+/* Set configUSE_SMP_LOCK_STATISTICS to 1 to have SMP FreeRTOS record, for each
+ * place in the kernel that acquires the task lock or the ISR lock, the number
+ * of acquisitions, the time spent waiting for the lock and the longest time the
+ * lock was held.  See vTaskGetLockStatistics().  Times are measured with
+ * portGET_LOCK_STATISTICS_TIMESTAMP(), which defaults to
+ * portGET_RUN_TIME_COUNTER_VALUE() but is best defined as a cycle counter.
+ * Only supported in SMP FreeRTOS.  Defaults to 0 if left undefined. */
+#define configUSE_SMP_LOCK_STATISTICS           0
+
 /******************************************************************************/
 /* Co-routine related definitions. ********************************************/
 /******************************************************************************/
@@ -546,10 +654,26 @@
  * vTaskPreemptionEnable APIs. */
 #define configUSE_TASK_PREEMPTION_DISABLE         0
 
+/* When configUSE_TASK_PREEMPTION_DISABLE is 1, set
+ * configUSE_PREEMPTION_DISABLE_BUDGET to 1 to limit how many ticks a task may
+ * keep preemption disabled for, and to record how long higher priority tasks
+ * were kept waiting by tasks that had preemption disabled.  A task that exceeds
+ * its budget causes xApplicationPreemptionDisableOverrunHook() to be called
+ * from the tick interrupt, which can return pdTRUE to enable preemption for
+ * the task again.  See vTaskPreemptionDisableBudgetSet() and
+ * vTaskGetPreemptionDisableStatistics().  configDEFAULT_PREEMPTION_DISABLE_BUDGET
+ * sets the budget of newly created tasks, where 0 means no limit.  Both default
+ * to 0 if left undefined. */
+#define configUSE_PREEMPTION_DISABLE_BUDGET       0
+#define configDEFAULT_PREEMPTION_DISABLE_BUDGET   0
+
 /* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
  * configUSE_PASSIVE_IDLE_HOOK to 1 to allow the application writer to use
  * the passive idle task hook to add background functionality without the
- * overhead of a separate task. Defaults to 0 if left undefined. */
+ * overhead of a separate task.  Ports that define portPASSIVE_IDLE_WAIT(),
+ * such as the RP2040 port, put the core to sleep after each call, so with
+ * preemption the hook runs once per interrupt or event on that core rather
+ * than continuously.  Defaults to 0 if left undefined. */
 #define configUSE_PASSIVE_IDLE_HOOK               0
 
 /* When using SMP (i.e. configNUMBER_OF_CORES is greater than one),
@@ -640,6 +764,7 @@
 #define configUSE_RECURSIVE_MUTEXES            1
 #define configUSE_COUNTING_SEMAPHORES          1
 #define configUSE_QUEUE_SETS                   0
+#define configUSE_PRIORITY_QUEUES              0
 #define configUSE_APPLICATION_TASK_TAG         0
 
 /* USE_POSIX_ERRNO enables the task global FreeRTOS_errno variable which will
@@ -329,6 +329,22 @@
     #define configUSE_EVENT_GROUPS    1
 #endif
 
+#ifndef configUSE_64_BIT_EVENT_GROUPS
+    #define configUSE_64_BIT_EVENT_GROUPS    0
+#endif
+
+#ifndef configUSE_BARRIERS
+    #define configUSE_BARRIERS    0
+#endif
+
+#if ( ( configUSE_BARRIERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_BARRIERS cannot be set to 1 when using an MPU port, because the MPU wrappers do not support barrier handles.
+#endif
+
+#ifndef configUSE_EVENT_GROUPS_DIRECT_ISR
+    #define configUSE_EVENT_GROUPS_DIRECT_ISR    0
+#endif
+
 #ifndef configUSE_STREAM_BUFFERS
     #define configUSE_STREAM_BUFFERS    1
 #endif
@@ -351,6 +367,14 @@
     #define configUSE_TASK_PREEMPTION_DISABLE    0
 #endif
 
+#ifndef configUSE_PREEMPTION_DISABLE_BUDGET
+    #define configUSE_PREEMPTION_DISABLE_BUDGET    0
+#endif
+
+#ifndef configDEFAULT_PREEMPTION_DISABLE_BUDGET
+    #define configDEFAULT_PREEMPTION_DISABLE_BUDGET    0
+#endif
+
 #ifndef configUSE_ALTERNATIVE_API
     #define configUSE_ALTERNATIVE_API    0
 #endif
@@ -595,6 +619,20 @@
     #define configUSE_MINI_LIST_ITEM    1
 #endif
 
+#ifndef configUSE_COMPACT_TCB
+    #define configUSE_COMPACT_TCB    0
+#endif
+
+#if ( configUSE_COMPACT_TCB == 1 )
+    #if ( configMAX_PRIORITIES > 256 )
+        #error configMAX_PRIORITIES must not be greater than 256 when configUSE_COMPACT_TCB is 1
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 127 )
+        #error configNUMBER_OF_CORES must not be greater than 127 when configUSE_COMPACT_TCB is 1
+    #endif
+#endif
+
 #ifndef portPOINTER_SIZE_TYPE
     #define portPOINTER_SIZE_TYPE    uint32_t
 #endif
@@ -936,6 +974,30 @@
     #define traceEVENT_GROUP_DELETE( xEventGroup )
 #endif
 
+#ifndef traceBARRIER_CREATE
+    #define traceBARRIER_CREATE( xBarrier )
+#endif
+
+#ifndef traceBARRIER_CREATE_FAILED
+    #define traceBARRIER_CREATE_FAILED()
+#endif
+
+#ifndef traceBARRIER_WAIT_BLOCK
+    #define traceBARRIER_WAIT_BLOCK( xBarrier )
+#endif
+
+#ifndef traceBARRIER_WAIT_END
+    #define traceBARRIER_WAIT_END( xBarrier, xReturn )
+#endif
+
+#ifndef traceBARRIER_RELEASE
+    #define traceBARRIER_RELEASE( xBarrier )
+#endif
+
+#ifndef traceBARRIER_DELETE
+    #define traceBARRIER_DELETE( xBarrier )
+#endif
+
 #ifndef tracePEND_FUNC_CALL
     #define tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, ret )
 #endif
@@ -976,6 +1038,29 @@
     #define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )
 #endif
 
+#ifndef traceKERNEL_LOCK_ACQUIRED
+
+/* Called by SMP FreeRTOS after acquiring the task lock or the ISR lock when
+ * configUSE_SMP_LOCK_STATISTICS is 1.  xLock is an eKernelLock, xSite an
+ * eLockSite, and ulWaitTime the time spent waiting for the lock. */
+    #define traceKERNEL_LOCK_ACQUIRED( xLock, xSite, ulWaitTime )
+#endif
+
+#ifndef traceKERNEL_LOCK_RELEASED
+
+/* Called by SMP FreeRTOS before releasing the task lock or the ISR lock when
+ * configUSE_SMP_LOCK_STATISTICS is 1.  xSite is where the lock was acquired,
+ * and ulHoldTime the time the lock was held. */
+    #define traceKERNEL_LOCK_RELEASED( xLock, xSite, ulHoldTime )
+#endif
+
+#ifndef traceTASK_PREEMPTION_DISABLE_OVERRUN
+
+/* Called from the tick interrupt when configUSE_PREEMPTION_DISABLE_BUDGET is 1
+ * and pxTCB has had preemption disabled for longer than its budget. */
+    #define traceTASK_PREEMPTION_DISABLE_OVERRUN( pxTCB )
+#endif
+
 #ifndef traceISR_EXIT_TO_SCHEDULER
     #define traceISR_EXIT_TO_SCHEDULER()
 #endif
@@ -1140,6 +1225,22 @@
     #define traceRETURN_vEventGroupClearBitsCallback()
 #endif
 
+#ifndef traceENTER_vEventGroupSetPendedBitsCallback
+    #define traceENTER_vEventGroupSetPendedBitsCallback( pvEventGroup, ulRequest )
+#endif
+
+#ifndef traceRETURN_vEventGroupSetPendedBitsCallback
+    #define traceRETURN_vEventGroupSetPendedBitsCallback()
+#endif
+
+#ifndef traceENTER_vEventGroupClearPendedBitsCallback
+    #define traceENTER_vEventGroupClearPendedBitsCallback( pvEventGroup, ulRequest )
+#endif
+
+#ifndef traceRETURN_vEventGroupClearPendedBitsCallback
+    #define traceRETURN_vEventGroupClearPendedBitsCallback()
+#endif
+
 #ifndef traceENTER_xEventGroupSetBitsFromISR
     #define traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken )
 #endif
@@ -1164,6 +1265,46 @@
     #define traceRETURN_vEventGroupSetNumber()
 #endif
 
+#ifndef traceENTER_xBarrierCreateStatic
+    #define traceENTER_xBarrierCreateStatic( uxParticipants, pxBarrierBuffer )
+#endif
+
+#ifndef traceRETURN_xBarrierCreateStatic
+    #define traceRETURN_xBarrierCreateStatic( pxBarrier )
+#endif
+
+#ifndef traceENTER_xBarrierCreate
+    #define traceENTER_xBarrierCreate( uxParticipants )
+#endif
+
+#ifndef traceRETURN_xBarrierCreate
+    #define traceRETURN_xBarrierCreate( pxBarrier )
+#endif
+
+#ifndef traceENTER_xBarrierWait
+    #define traceENTER_xBarrierWait( xBarrier, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xBarrierWait
+    #define traceRETURN_xBarrierWait( xReturn )
+#endif
+
+#ifndef traceENTER_uxBarrierGetGeneration
+    #define traceENTER_uxBarrierGetGeneration( xBarrier )
+#endif
+
+#ifndef traceRETURN_uxBarrierGetGeneration
+    #define traceRETURN_uxBarrierGetGeneration( uxReturn )
+#endif
+
+#ifndef traceENTER_vBarrierDelete
+    #define traceENTER_vBarrierDelete( xBarrier )
+#endif
+
+#ifndef traceRETURN_vBarrierDelete
+    #define traceRETURN_vBarrierDelete()
+#endif
+
 #ifndef traceENTER_xQueueGenericReset
     #define traceENTER_xQueueGenericReset( xQueue, xNewQueue )
 #endif
@@ -1196,6 +1337,14 @@
     #define traceRETURN_xQueueGenericCreate( pxNewQueue )
 #endif
 
+#ifndef traceENTER_xQueueCreatePriority
+    #define traceENTER_xQueueCreatePriority( uxQueueLength, uxItemSize, uxNumberOfPriorities )
+#endif
+
+#ifndef traceRETURN_xQueueCreatePriority
+    #define traceRETURN_xQueueCreatePriority( pxNewQueue )
+#endif
+
 #ifndef traceENTER_xQueueCreateMutex
     #define traceENTER_xQueueCreateMutex( ucQueueType )
 #endif
@@ -1308,6 +1457,22 @@
     #define traceRETURN_xQueuePeek( xReturn )
 #endif
 
+#ifndef traceENTER_xQueuePeekInPlace
+    #define traceENTER_xQueuePeekInPlace( xQueue, ppvItems, puxItemsAvailable, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueuePeekInPlace
+    #define traceRETURN_xQueuePeekInPlace( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueReleaseInPlace
+    #define traceENTER_xQueueReleaseInPlace( xQueue, uxItemsToRelease )
+#endif
+
+#ifndef traceRETURN_xQueueReleaseInPlace
+    #define traceRETURN_xQueueReleaseInPlace( xReturn )
+#endif
+
 #ifndef traceENTER_xQueueReceiveFromISR
     #define traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )
 #endif
@@ -1852,6 +2017,102 @@
     #define traceRETURN_vTaskPreemptionEnable()
 #endif
 
+#ifndef traceENTER_vTaskPreemptionDisableBudgetSet
+    #define traceENTER_vTaskPreemptionDisableBudgetSet( xTask, xTicks )
+#endif
+
+#ifndef traceRETURN_vTaskPreemptionDisableBudgetSet
+    #define traceRETURN_vTaskPreemptionDisableBudgetSet()
+#endif
+
+#ifndef traceENTER_xTaskPreemptionDisableBudgetGet
+    #define traceENTER_xTaskPreemptionDisableBudgetGet( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskPreemptionDisableBudgetGet
+    #define traceRETURN_xTaskPreemptionDisableBudgetGet( xBudget )
+#endif
+
+#ifndef traceENTER_vTaskGetPreemptionDisableStatistics
+    #define traceENTER_vTaskGetPreemptionDisableStatistics( pxStatistics )
+#endif
+
+#ifndef traceRETURN_vTaskGetPreemptionDisableStatistics
+    #define traceRETURN_vTaskGetPreemptionDisableStatistics()
+#endif
+
+#ifndef traceENTER_vTaskResetPreemptionDisableStatistics
+    #define traceENTER_vTaskResetPreemptionDisableStatistics()
+#endif
+
+#ifndef traceRETURN_vTaskResetPreemptionDisableStatistics
+    #define traceRETURN_vTaskResetPreemptionDisableStatistics()
+#endif
+
+#ifndef traceENTER_vTaskTimeSliceSet
+    #define traceENTER_vTaskTimeSliceSet( xTask, xTicks )
+#endif
+
+#ifndef traceRETURN_vTaskTimeSliceSet
+    #define traceRETURN_vTaskTimeSliceSet()
+#endif
+
+#ifndef traceENTER_xTaskTimeSliceGet
+    #define traceENTER_xTaskTimeSliceGet( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskTimeSliceGet
+    #define traceRETURN_xTaskTimeSliceGet( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskFairShareWeightSet
+    #define traceENTER_vTaskFairShareWeightSet( xTask, uxWeight )
+#endif
+
+#ifndef traceRETURN_vTaskFairShareWeightSet
+    #define traceRETURN_vTaskFairShareWeightSet()
+#endif
+
+#ifndef traceENTER_uxTaskFairShareWeightGet
+    #define traceENTER_uxTaskFairShareWeightGet( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskFairShareWeightGet
+    #define traceRETURN_uxTaskFairShareWeightGet( uxReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetBlockTimeLimit
+    #define traceENTER_vTaskSetBlockTimeLimit( xTask, xBlockTimeLimit )
+#endif
+
+#ifndef traceRETURN_vTaskSetBlockTimeLimit
+    #define traceRETURN_vTaskSetBlockTimeLimit()
+#endif
+
+#ifndef traceENTER_vTaskCheckForDeadlocks
+    #define traceENTER_vTaskCheckForDeadlocks()
+#endif
+
+#ifndef traceRETURN_vTaskCheckForDeadlocks
+    #define traceRETURN_vTaskCheckForDeadlocks()
+#endif
+
+#ifndef traceENTER_xTaskWriteSnapshot
+    #define traceENTER_xTaskWriteSnapshot( pvBuffer, xBufferSize )
+#endif
+
+#ifndef traceRETURN_xTaskWriteSnapshot
+    #define traceRETURN_xTaskWriteSnapshot( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetBlockingMutex
+    #define traceENTER_vTaskSetBlockingMutex( pvMutex, pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_vTaskSetBlockingMutex
+    #define traceRETURN_vTaskSetBlockingMutex()
+#endif
+
 #ifndef traceENTER_vTaskSuspend
     #define traceENTER_vTaskSuspend( xTaskToSuspend )
 #endif
@@ -2096,6 +2357,14 @@
     #define traceRETURN_vTaskRemoveFromUnorderedEventList()
 #endif
 
+#ifndef traceENTER_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskSetTimeOutState
     #define traceENTER_vTaskSetTimeOutState( pxTimeOut )
 #endif
@@ -2288,6 +2557,22 @@
     #define traceRETURN_vTaskExitCriticalFromISR()
 #endif
 
+#ifndef traceENTER_vTaskGetLockStatistics
+    #define traceENTER_vTaskGetLockStatistics( eSite, eLock, pxLockStatistics )
+#endif
+
+#ifndef traceRETURN_vTaskGetLockStatistics
+    #define traceRETURN_vTaskGetLockStatistics()
+#endif
+
+#ifndef traceENTER_vTaskResetLockStatistics
+    #define traceENTER_vTaskResetLockStatistics()
+#endif
+
+#ifndef traceRETURN_vTaskResetLockStatistics
+    #define traceRETURN_vTaskResetLockStatistics()
+#endif
+
 #ifndef traceENTER_vTaskListTasks
     #define traceENTER_vTaskListTasks( pcWriteBuffer, uxBufferLength )
 #endif
@@ -2304,6 +2589,22 @@
     #define traceRETURN_vTaskGetRunTimeStatistics()
 #endif
 
+#ifndef traceENTER_vTaskListTasksStreaming
+    #define traceENTER_vTaskListTasksStreaming( pxRowCallback, pvContext )
+#endif
+
+#ifndef traceRETURN_vTaskListTasksStreaming
+    #define traceRETURN_vTaskListTasksStreaming()
+#endif
+
+#ifndef traceENTER_vTaskGetRunTimeStatisticsStreaming
+    #define traceENTER_vTaskGetRunTimeStatisticsStreaming( pxRowCallback, pvContext )
+#endif
+
+#ifndef traceRETURN_vTaskGetRunTimeStatisticsStreaming
+    #define traceRETURN_vTaskGetRunTimeStatisticsStreaming()
+#endif
+
 #ifndef traceENTER_uxTaskResetEventItemValue
     #define traceENTER_uxTaskResetEventItemValue()
 #endif
@@ -2312,6 +2613,14 @@
     #define traceRETURN_uxTaskResetEventItemValue( uxReturn )
 #endif
 
+#ifndef traceENTER_uxTaskGetEventItemValue
+    #define traceENTER_uxTaskGetEventItemValue( pxEventListItem )
+#endif
+
+#ifndef traceRETURN_uxTaskGetEventItemValue
+    #define traceRETURN_uxTaskGetEventItemValue( uxReturn )
+#endif
+
 #ifndef traceENTER_pvTaskIncrementMutexHeldCount
     #define traceENTER_pvTaskIncrementMutexHeldCount()
 #endif
@@ -2352,6 +2661,14 @@
     #define traceRETURN_xTaskGenericNotifyFromISR( xReturn )
 #endif
 
+#ifndef traceENTER_xTaskNotifyMultipleFromISR
+    #define traceENTER_xTaskNotifyMultipleFromISR( pxTargets, uxNumberOfTargets, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xTaskNotifyMultipleFromISR
+    #define traceRETURN_xTaskNotifyMultipleFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskGenericNotifyGiveFromISR
     #define traceENTER_vTaskGenericNotifyGiveFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken )
 #endif
@@ -2706,6 +3023,14 @@
     #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
 #endif
 
+/* Called on each iteration of a passive idle task when preemption is used.  A
+ * port can wait for an interrupt here, as the kernel always yields a core that
+ * is running a passive idle task once another task can run on it.  A port that
+ * waits here calls the passive idle hook once per wake up, not continuously. */
+#ifndef portPASSIVE_IDLE_WAIT
+    #define portPASSIVE_IDLE_WAIT()
+#endif
+
 #ifndef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
     #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
 #endif
@@ -2734,6 +3059,10 @@
     #define configUSE_QUEUE_SETS    0
 #endif
 
+#ifndef configUSE_PRIORITY_QUEUES
+    #define configUSE_PRIORITY_QUEUES    0
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
     #define portTASK_USES_FLOATING_POINT()
 #endif
@@ -2750,6 +3079,100 @@
     #define configUSE_TIME_SLICING    1
 #endif
 
+#ifndef configUSE_TIME_SLICE_LENGTH
+    #define configUSE_TIME_SLICE_LENGTH    0
+#endif
+
+#ifndef configDEFAULT_TIME_SLICE_LENGTH
+    #define configDEFAULT_TIME_SLICE_LENGTH    1
+#endif
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+    #if ( ( configUSE_PREEMPTION == 0 ) || ( configUSE_TIME_SLICING == 0 ) )
+        #error configUSE_PREEMPTION and configUSE_TIME_SLICING must be set to 1 to use configUSE_TIME_SLICE_LENGTH
+    #endif
+
+    #if ( configDEFAULT_TIME_SLICE_LENGTH < 1 )
+        #error configDEFAULT_TIME_SLICE_LENGTH must be at least 1
+    #endif
+#endif
+
+#ifndef configUSE_FAIR_SHARE_SCHEDULING
+    #define configUSE_FAIR_SHARE_SCHEDULING    0
+#endif
+
+#ifndef configFAIR_SHARE_PRIORITY
+    #define configFAIR_SHARE_PRIORITY    1
+#endif
+
+#ifndef configFAIR_SHARE_MAX_READY_TASKS
+    #define configFAIR_SHARE_MAX_READY_TASKS    8
+#endif
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_FAIR_SHARE_SCHEDULING is not supported in SMP FreeRTOS
+    #endif
+
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configGENERATE_RUN_TIME_STATS must be set to 1 to use configUSE_FAIR_SHARE_SCHEDULING
+    #endif
+
+    #if ( ( configFAIR_SHARE_PRIORITY < 1 ) || ( configFAIR_SHARE_PRIORITY >= configMAX_PRIORITIES ) )
+        #error configFAIR_SHARE_PRIORITY must be above the idle priority and below configMAX_PRIORITIES
+    #endif
+
+    #if ( configFAIR_SHARE_MAX_READY_TASKS < 1 )
+        #error configFAIR_SHARE_MAX_READY_TASKS must be at least 1
+    #endif
+
+    #if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+        #error configUSE_FAIR_SHARE_SCHEDULING requires TickType_t to be at least 32 bits wide
+    #endif
+#endif
+
+#ifndef configUSE_DEADLOCK_DETECTION
+    #define configUSE_DEADLOCK_DETECTION    0
+#endif
+
+#ifndef configDEADLOCK_DETECTION_PERIOD
+    #define configDEADLOCK_DETECTION_PERIOD    configTICK_RATE_HZ
+#endif
+
+#ifndef configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH
+    #define configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH    8
+#endif
+
+#if ( ( configUSE_DEADLOCK_DETECTION == 1 ) && ( configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH < 2 ) )
+    #error configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH must be at least 2
+#endif
+
+#ifndef configUSE_KERNEL_SNAPSHOT
+    #define configUSE_KERNEL_SNAPSHOT    0
+#endif
+
+#ifndef configKERNEL_SNAPSHOT_INCLUDE_HEAP
+    #define configKERNEL_SNAPSHOT_INCLUDE_HEAP    0
+#endif
+
+#ifndef configUSE_SMP_LOCK_STATISTICS
+    #define configUSE_SMP_LOCK_STATISTICS    0
+#endif
+
+#if ( configUSE_SMP_LOCK_STATISTICS == 1 )
+    #if ( configNUMBER_OF_CORES == 1 )
+        #error configUSE_SMP_LOCK_STATISTICS is only supported in SMP FreeRTOS
+    #endif
+
+    #ifndef portGET_LOCK_STATISTICS_TIMESTAMP
+        #ifdef portGET_RUN_TIME_COUNTER_VALUE
+            #define portGET_LOCK_STATISTICS_TIMESTAMP()    portGET_RUN_TIME_COUNTER_VALUE()
+        #else
+            #error If configUSE_SMP_LOCK_STATISTICS is 1 then portGET_LOCK_STATISTICS_TIMESTAMP or portGET_RUN_TIME_COUNTER_VALUE must be defined.  portGET_LOCK_STATISTICS_TIMESTAMP should return a configRUN_TIME_COUNTER_TYPE value from a free running counter, ideally a cycle counter, that can be read on any core.
+        #endif
+    #endif /* portGET_LOCK_STATISTICS_TIMESTAMP */
+#endif /* configUSE_SMP_LOCK_STATISTICS */
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
     #define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS    0
 #endif
@@ -2867,7 +3290,19 @@
     #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
 #endif
 
+#ifndef configMESSAGE_BUFFER_ALIGNMENT
+
+/* Defaults to 1 so message buffer records are packed byte for byte, as they
+ * always have been.  Set to a larger power of two in FreeRTOSConfig.h to pad
+ * every record so each message starts on that alignment. */
+    #define configMESSAGE_BUFFER_ALIGNMENT    1
+#endif
+
 /* Sanity check the configuration. */
+#if ( ( configMESSAGE_BUFFER_ALIGNMENT < 1 ) || ( ( configMESSAGE_BUFFER_ALIGNMENT & ( configMESSAGE_BUFFER_ALIGNMENT - 1 ) ) != 0 ) )
+    #error configMESSAGE_BUFFER_ALIGNMENT must be a power of two.
+#endif
+
 #if ( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
     #error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
 #endif
@@ -2888,6 +3323,10 @@
     #error configUSE_TASK_PREEMPTION_DISABLE is not supported in single core FreeRTOS
 #endif
 
+#if ( ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 1 ) )
+    #error configUSE_TASK_PREEMPTION_DISABLE must be set to 1 to use configUSE_PREEMPTION_DISABLE_BUDGET
+#endif
+
 #if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_AFFINITY != 0 ) )
     #error configUSE_CORE_AFFINITY is not supported in single core FreeRTOS
 #endif
@@ -3171,16 +3610,47 @@ typedef struct xSTATIC_TCB
         UBaseType_t uxDummy26;
     #endif
     StaticListItem_t xDummy3[ 2 ];
-    UBaseType_t uxDummy5;
+    #if ( configUSE_COMPACT_TCB == 0 )
+        UBaseType_t uxDummy5;
+    #endif
     void * pxDummy6;
-    #if ( configNUMBER_OF_CORES > 1 )
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
         BaseType_t xDummy23;
         UBaseType_t uxDummy24;
     #endif
     uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+    #if ( configUSE_COMPACT_TCB == 1 )
+        uint8_t ucDummy36;
+        #if ( configNUMBER_OF_CORES > 1 )
+            int8_t cDummy37;
+            uint8_t ucDummy38;
+        #endif
+        #if ( configUSE_MUTEXES == 1 )
+            uint8_t ucDummy39[ 2 ];
+        #endif
+    #endif
     #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
         BaseType_t xDummy25;
     #endif
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        TickType_t xDummy34[ 3 ];
+        BaseType_t xDummy35[ 2 ];
+    #endif
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+        TickType_t xDummy27[ 2 ];
+    #endif
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+        TickType_t xDummy28;
+        UBaseType_t uxDummy29[ 2 ];
+    #endif
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+        uint64_t uxDummy30;
+    #endif
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        TickType_t xDummy31[ 2 ];
+        void * pvDummy32[ 2 ];
+        uint8_t ucDummy33;
+    #endif
     #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
         void * pxDummy8;
     #endif
@@ -3190,7 +3660,7 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy10[ 2 ];
     #endif
-    #if ( configUSE_MUTEXES == 1 )
+    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
         UBaseType_t uxDummy12[ 2 ];
     #endif
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -3257,6 +3727,10 @@ typedef struct xSTATIC_QUEUE
         void * pvDummy7;
     #endif
 
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        void * pvDummy10;
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
@@ -3280,7 +3754,11 @@ typedef StaticQueue_t StaticSemaphore_t;
  */
 typedef struct xSTATIC_EVENT_GROUP
 {
-    TickType_t xDummy1;
+    #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        uint64_t uxDummy1;
+    #else
+        TickType_t xDummy1;
+    #endif
     StaticList_t xDummy2;
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -3292,6 +3770,26 @@ typedef struct xSTATIC_EVENT_GROUP
     #endif
 } StaticEventGroup_t;
 
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the barrier structure used internally by FreeRTOS is
+ * not accessible to application code.  The StaticBarrier_t structure below is
+ * provided so the application writer can statically allocate the memory
+ * required to create a barrier.  Its sizes and alignment requirements are
+ * guaranteed to match those of the genuine structure, no matter which
+ * architecture is being used, and no matter how the values in FreeRTOSConfig.h
+ * are set.
+ */
+typedef struct xSTATIC_BARRIER
+{
+    UBaseType_t uxDummy1[ 3 ];
+    StaticList_t xDummy2;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy3;
+    #endif
+} StaticBarrier_t;
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -0,0 +1,218 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef BARRIER_H
+#define BARRIER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include barrier.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A barrier is a synchronisation point for a fixed number of tasks (the
+ * participants).  Each participant calls xBarrierWait() when it reaches the
+ * synchronisation point, and blocks until all the participants have done the
+ * same, at which time they are all released together.  The barrier then resets
+ * itself, so the same barrier can be used to synchronise each successive phase
+ * of a repeating computation.
+ *
+ * Unlike xEventGroupSync(), the number of participants is not limited by the
+ * number of bits in an event group, and arriving at the barrier takes the same
+ * time however many tasks are already waiting.  The last task to arrive readies
+ * all the waiting tasks in a single pass with the scheduler suspended.
+ */
+
+/**
+ * barrier.h
+ *
+ * Type by which barriers are referenced.  For example, a call to
+ * xBarrierCreate() returns a BarrierHandle_t variable that can then be used as
+ * a parameter to other barrier functions.
+ *
+ * \defgroup BarrierHandle_t BarrierHandle_t
+ * \ingroup Barrier
+ */
+struct BarrierDef_t;
+typedef struct BarrierDef_t * BarrierHandle_t;
+
+/**
+ * barrier.h
+ * @code{c}
+ * BarrierHandle_t xBarrierCreate( UBaseType_t uxParticipants );
+ * @endcode
+ *
+ * Create a new barrier for uxParticipants tasks, allocating the memory it
+ * requires from the FreeRTOS heap.
+ *
+ * The configUSE_BARRIERS and configSUPPORT_DYNAMIC_ALLOCATION configuration
+ * constants must both be set to 1 for xBarrierCreate() to be available.
+ *
+ * @param uxParticipants The number of tasks that must call xBarrierWait() before
+ * any of them are released.  Must be greater than zero.
+ *
+ * @return If the barrier was created then a handle to the barrier is returned.
+ * If there was insufficient FreeRTOS heap available to create the barrier then
+ * NULL is returned.
+ *
+ * \defgroup xBarrierCreate xBarrierCreate
+ * \ingroup Barrier
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BarrierHandle_t xBarrierCreate( UBaseType_t uxParticipants ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * barrier.h
+ * @code{c}
+ * BarrierHandle_t xBarrierCreateStatic( UBaseType_t uxParticipants,
+ *                                       StaticBarrier_t * pxBarrierBuffer );
+ * @endcode
+ *
+ * Create a new barrier for uxParticipants tasks using memory provided by the
+ * application writer.
+ *
+ * The configUSE_BARRIERS and configSUPPORT_STATIC_ALLOCATION configuration
+ * constants must both be set to 1 for xBarrierCreateStatic() to be available.
+ *
+ * @param uxParticipants The number of tasks that must call xBarrierWait() before
+ * any of them are released.  Must be greater than zero.
+ *
+ * @param pxBarrierBuffer Must point to a variable of type StaticBarrier_t, which
+ * will then be used to hold the barrier's data structures.
+ *
+ * @return If the barrier was created then a handle to the barrier is returned.
+ * If pxBarrierBuffer was NULL then NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  // StaticBarrier_t is a publicly accessible structure that has the same size
+ *  // and alignment requirements as the real barrier structure.
+ *  StaticBarrier_t xBarrierBuffer;
+ *
+ *  // Create a barrier for four tasks.
+ *  BarrierHandle_t xBarrier = xBarrierCreateStatic( 4, &xBarrierBuffer );
+ * @endcode
+ *
+ * \defgroup xBarrierCreateStatic xBarrierCreateStatic
+ * \ingroup Barrier
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    BarrierHandle_t xBarrierCreateStatic( UBaseType_t uxParticipants,
+                                          StaticBarrier_t * pxBarrierBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * barrier.h
+ * @code{c}
+ * BaseType_t xBarrierWait( BarrierHandle_t xBarrier,
+ *                          TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Arrive at the barrier, then wait for the remaining participants to arrive.
+ * The last task to arrive does not block - it releases all the waiting tasks
+ * and starts the next phase of the barrier.
+ *
+ * This function must not be called from an interrupt service routine.
+ *
+ * @param xBarrier The barrier being waited on.
+ *
+ * @param xTicksToWait The maximum amount of time (specified in 'ticks') to wait
+ * for the remaining participants to arrive.  A task that times out withdraws
+ * its arrival, so the barrier still requires uxParticipants calls to
+ * xBarrierWait() to complete the current phase.
+ *
+ * @return pdPASS if all the participants arrived, or pdFAIL if the block time
+ * expired first.
+ *
+ * Example usage:
+ * @code{c}
+ *  void vWorkerTask( void * pvParameters )
+ *  {
+ *      for( ;; )
+ *      {
+ *          // Perform this task's share of the current step.
+ *          vDoWork();
+ *
+ *          // Wait for the other workers to finish the same step.
+ *          ( void ) xBarrierWait( xBarrier, portMAX_DELAY );
+ *      }
+ *  }
+ * @endcode
+ *
+ * \defgroup xBarrierWait xBarrierWait
+ * \ingroup Barrier
+ */
+BaseType_t xBarrierWait( BarrierHandle_t xBarrier,
+                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ * @code{c}
+ * UBaseType_t uxBarrierGetGeneration( BarrierHandle_t xBarrier );
+ * @endcode
+ *
+ * Returns the number of times the barrier has released its participants.
+ *
+ * \defgroup uxBarrierGetGeneration uxBarrierGetGeneration
+ * \ingroup Barrier
+ */
+UBaseType_t uxBarrierGetGeneration( BarrierHandle_t xBarrier ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ * @code{c}
+ * void vBarrierDelete( BarrierHandle_t xBarrier );
+ * @endcode
+ *
+ * Delete a barrier that was previously created by a call to xBarrierCreate()
+ * or xBarrierCreateStatic().  A barrier must not be deleted while tasks are
+ * waiting on it.
+ *
+ * @param xBarrier The barrier being deleted.
+ *
+ * \defgroup vBarrierDelete vBarrierDelete
+ * \ingroup Barrier
+ */
+void vBarrierDelete( BarrierHandle_t xBarrier ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* BARRIER_H */
@@ -39,7 +39,12 @@
 /* The following bit fields convey control information in a task's event list
  * item value.  It is important they don't clash with the
  * taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
-#if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+#if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+    #define eventCLEAR_EVENTS_ON_EXIT_BIT    ( ( uint64_t ) 0x0100000000000000U )
+    #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint64_t ) 0x0200000000000000U )
+    #define eventWAIT_FOR_ALL_BITS           ( ( uint64_t ) 0x0400000000000000U )
+    #define eventEVENT_BITS_CONTROL_BYTES    ( ( uint64_t ) 0xff00000000000000U )
+#elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
     #define eventCLEAR_EVENTS_ON_EXIT_BIT    ( ( uint16_t ) 0x0100U )
     #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint16_t ) 0x0200U )
     #define eventWAIT_FOR_ALL_BITS           ( ( uint16_t ) 0x0400U )
@@ -54,7 +59,7 @@
     #define eventUNBLOCKED_DUE_TO_BIT_SET    ( ( uint64_t ) 0x0200000000000000U )
     #define eventWAIT_FOR_ALL_BITS           ( ( uint64_t ) 0x0400000000000000U )
     #define eventEVENT_BITS_CONTROL_BYTES    ( ( uint64_t ) 0xff00000000000000U )
-#endif /* if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS ) */
+#endif /* if ( configUSE_64_BIT_EVENT_GROUPS == 1 ) */
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -103,14 +108,21 @@ struct EventGroupDef_t;
 typedef struct EventGroupDef_t   * EventGroupHandle_t;
 
 /*
- * The type that holds event bits always matches TickType_t - therefore the
- * number of bits it holds is set by configTICK_TYPE_WIDTH_IN_BITS (16 bits if set to 0,
- * 32 bits if set to 1, 64 bits if set to 2.
+ * The type that holds event bits matches TickType_t - therefore the number of
+ * bits it holds is set by configTICK_TYPE_WIDTH_IN_BITS (16 bits if set to 0,
+ * 32 bits if set to 1, 64 bits if set to 2) - unless
+ * configUSE_64_BIT_EVENT_GROUPS is set to 1, in which case it is 64 bits wide
+ * whatever the width of TickType_t.  The top 8 bits are reserved for use by the
+ * kernel, leaving 8, 24 or 56 bits for the application.
  *
  * \defgroup EventBits_t EventBits_t
  * \ingroup EventGroup
  */
-typedef TickType_t               EventBits_t;
+#if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+    typedef uint64_t             EventBits_t;
+#else
+    typedef TickType_t           EventBits_t;
+#endif
 
 /**
  * event_groups.h
@@ -452,7 +464,7 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupClearBitsFromISR xEventGroupClearBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) || ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) )
     BaseType_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                             const EventBits_t uxBitsToClear ) PRIVILEGED_FUNCTION;
 #else
@@ -551,6 +563,16 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * context of the timer task - where a scheduler lock is used in place of a
  * critical section.
  *
+ * If configUSE_EVENT_GROUPS_DIRECT_ISR is set to 1 in FreeRTOSConfig.h then the
+ * bits are instead set, and any tasks they unblock are readied, by
+ * xEventGroupSetBitsFromISR() itself.  That avoids the latency of the timer
+ * task, at the cost of time in a critical section proportional to the number
+ * of tasks waiting on the event group - both in the interrupt and whenever a
+ * task accesses the event group.  The timer task is not used, so
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if a task that has a priority
+ * above that of the interrupted task was unblocked, and pdPASS is always
+ * returned.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -607,7 +629,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) || ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) )
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                           const EventBits_t uxBitsToSet,
                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
@@ -837,6 +859,12 @@ void vEventGroupSetBitsCallback( void * pvEventGroup,
                                  uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
 void vEventGroupClearBitsCallback( void * pvEventGroup,
                                    uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
+#if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+    void vEventGroupSetPendedBitsCallback( void * pvEventGroup,
+                                           uint32_t ulRequest ) PRIVILEGED_FUNCTION;
+    void vEventGroupClearPendedBitsCallback( void * pvEventGroup,
+                                             uint32_t ulRequest ) PRIVILEGED_FUNCTION;
+#endif
 
 
 #if ( configUSE_TRACE_FACILITY == 1 )
@@ -58,6 +58,15 @@
  * architecture will actually reduce the available space in the message buffer
  * by 14 bytes (10 byte are used by the message, and 4 bytes to hold the length
  * of the message).
+ *
+ * If configMESSAGE_BUFFER_ALIGNMENT is set above 1 in FreeRTOSConfig.h then the
+ * length and the message are each padded up to a multiple of
+ * configMESSAGE_BUFFER_ALIGNMENT bytes, so every message starts at an aligned
+ * offset within the buffer.  With configMESSAGE_BUFFER_ALIGNMENT set to 8 the
+ * 10 byte message above reduces the available space by 24 bytes (8 bytes for
+ * the length and 16 for the padded message).  In that case the storage area of
+ * a statically allocated message buffer must be aligned to, and its size a
+ * multiple of, configMESSAGE_BUFFER_ALIGNMENT bytes.
  */
 
 #ifndef FREERTOS_MESSAGE_BUFFER_H
@@ -165,6 +165,31 @@ BaseType_t MPU_xTaskGetSchedulerState( void ) FREERTOS_SYSTEM_CALL;
     BaseType_t MPU_xTaskCatchUpTicks( TickType_t xTicksToCatchUp ) FREERTOS_SYSTEM_CALL;
     BaseType_t MPU_xTaskResumeAll( void ) FREERTOS_SYSTEM_CALL;
 
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        void MPU_vTaskPreemptionDisableBudgetSet( TaskHandle_t xTask,
+                                                  TickType_t xTicks ) FREERTOS_SYSTEM_CALL;
+        TickType_t MPU_xTaskPreemptionDisableBudgetGet( ConstTaskHandle_t xTask ) FREERTOS_SYSTEM_CALL;
+        void MPU_vTaskGetPreemptionDisableStatistics( PreemptionDisableStatistics_t * pxStatistics ) FREERTOS_SYSTEM_CALL;
+        void MPU_vTaskResetPreemptionDisableStatistics( void ) FREERTOS_SYSTEM_CALL;
+    #endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+        void MPU_vTaskTimeSliceSet( TaskHandle_t xTask,
+                                    TickType_t xTicks ) FREERTOS_SYSTEM_CALL;
+        TickType_t MPU_xTaskTimeSliceGet( ConstTaskHandle_t xTask ) FREERTOS_SYSTEM_CALL;
+    #endif /* #if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+        void MPU_vTaskFairShareWeightSet( TaskHandle_t xTask,
+                                          UBaseType_t uxWeight ) FREERTOS_SYSTEM_CALL;
+        UBaseType_t MPU_uxTaskFairShareWeightGet( ConstTaskHandle_t xTask ) FREERTOS_SYSTEM_CALL;
+    #endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        void MPU_vTaskSetBlockTimeLimit( TaskHandle_t xTask,
+                                         TickType_t xBlockTimeLimit ) FREERTOS_SYSTEM_CALL;
+    #endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+
 #else /* #if ( configUSE_MPU_WRAPPERS_V1 == 1 ) */
 
     BaseType_t MPU_xTaskCreate( TaskFunction_t pxTaskCode,
@@ -187,6 +212,29 @@ BaseType_t MPU_xTaskGetSchedulerState( void ) FREERTOS_SYSTEM_CALL;
     BaseType_t MPU_xTaskCallApplicationTaskHook( TaskHandle_t xTask,
                                                  void * pvParameter ) PRIVILEGED_FUNCTION;
 
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        void MPU_vTaskPreemptionDisableBudgetSet( TaskHandle_t xTask,
+                                                  TickType_t xTicks ) PRIVILEGED_FUNCTION;
+        TickType_t MPU_xTaskPreemptionDisableBudgetGet( ConstTaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+    #endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+        void MPU_vTaskTimeSliceSet( TaskHandle_t xTask,
+                                    TickType_t xTicks ) PRIVILEGED_FUNCTION;
+        TickType_t MPU_xTaskTimeSliceGet( ConstTaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+    #endif /* #if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+        void MPU_vTaskFairShareWeightSet( TaskHandle_t xTask,
+                                          UBaseType_t uxWeight ) PRIVILEGED_FUNCTION;
+        UBaseType_t MPU_uxTaskFairShareWeightGet( ConstTaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+    #endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        void MPU_vTaskSetBlockTimeLimit( TaskHandle_t xTask,
+                                         TickType_t xBlockTimeLimit ) PRIVILEGED_FUNCTION;
+    #endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+
 #endif /* #if ( configUSE_MPU_WRAPPERS_V1 == 1 ) */
 
 char * MPU_pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
@@ -213,6 +261,9 @@ BaseType_t MPU_xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
 void MPU_vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify,
                                         UBaseType_t uxIndexToNotify,
                                         BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+BaseType_t MPU_xTaskNotifyMultipleFromISR( const TaskNotifyTarget_t * pxTargets,
+                                           UBaseType_t uxNumberOfTargets,
+                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
 /* MPU versions of queue.h API functions. */
 BaseType_t MPU_xQueueGenericSend( QueueHandle_t xQueue,
@@ -263,6 +314,9 @@ uint8_t MPU_ucQueueGetQueueType( QueueHandle_t xQueue ) FREERTOS_SYSTEM_CALL;
     QueueHandle_t MPU_xQueueGenericCreate( const UBaseType_t uxQueueLength,
                                            const UBaseType_t uxItemSize,
                                            const uint8_t ucQueueType ) FREERTOS_SYSTEM_CALL;
+    QueueHandle_t MPU_xQueueCreatePriority( const UBaseType_t uxQueueLength,
+                                            const UBaseType_t uxItemSize,
+                                            const UBaseType_t uxNumberOfPriorities ) FREERTOS_SYSTEM_CALL;
     QueueHandle_t MPU_xQueueGenericCreateStatic( const UBaseType_t uxQueueLength,
                                                  const UBaseType_t uxItemSize,
                                                  uint8_t * pucQueueStorage,
@@ -291,6 +345,9 @@ uint8_t MPU_ucQueueGetQueueType( QueueHandle_t xQueue ) FREERTOS_SYSTEM_CALL;
     QueueHandle_t MPU_xQueueGenericCreate( const UBaseType_t uxQueueLength,
                                            const UBaseType_t uxItemSize,
                                            const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+    QueueHandle_t MPU_xQueueCreatePriority( const UBaseType_t uxQueueLength,
+                                            const UBaseType_t uxItemSize,
+                                            const UBaseType_t uxNumberOfPriorities ) PRIVILEGED_FUNCTION;
     QueueHandle_t MPU_xQueueGenericCreateStatic( const UBaseType_t uxQueueLength,
                                                  const UBaseType_t uxItemSize,
                                                  uint8_t * pucQueueStorage,
@@ -326,6 +383,12 @@ BaseType_t MPU_xQueueIsQueueFullFromISR( const QueueHandle_t xQueue ) PRIVILEGED
 UBaseType_t MPU_uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 TaskHandle_t MPU_xQueueGetMutexHolderFromISR( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 QueueSetMemberHandle_t MPU_xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
+BaseType_t MPU_xQueuePeekInPlace( QueueHandle_t xQueue,
+                                  void ** const ppvItems,
+                                  UBaseType_t * const puxItemsAvailable,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t MPU_xQueueReleaseInPlace( QueueHandle_t xQueue,
+                                     UBaseType_t uxItemsToRelease ) PRIVILEGED_FUNCTION;
 
 /* MPU versions of timers.h API functions. */
 void * MPU_pvTimerGetTimerID( const TimerHandle_t xTimer ) FREERTOS_SYSTEM_CALL;
@@ -90,11 +90,13 @@
 /* These are not needed in v2 because they do not take a task
  * handle and therefore, no lookup is needed. Needed in v1 because
  * these are available as system calls in v1. */
-            #define vTaskGetRunTimeStatistics            MPU_vTaskGetRunTimeStatistics
-            #define vTaskListTasks                       MPU_vTaskListTasks
-            #define vTaskSuspendAll                      MPU_vTaskSuspendAll
-            #define xTaskCatchUpTicks                    MPU_xTaskCatchUpTicks
-            #define xTaskResumeAll                       MPU_xTaskResumeAll
+            #define vTaskGetRunTimeStatistics                MPU_vTaskGetRunTimeStatistics
+            #define vTaskListTasks                           MPU_vTaskListTasks
+            #define vTaskSuspendAll                          MPU_vTaskSuspendAll
+            #define xTaskCatchUpTicks                        MPU_xTaskCatchUpTicks
+            #define xTaskResumeAll                           MPU_xTaskResumeAll
+            #define vTaskGetPreemptionDisableStatistics      MPU_vTaskGetPreemptionDisableStatistics
+            #define vTaskResetPreemptionDisableStatistics    MPU_vTaskResetPreemptionDisableStatistics
         #endif /* #if ( configUSE_MPU_WRAPPERS_V1 == 1 ) */
 
         #define xTaskCreate                              MPU_xTaskCreate
@@ -103,6 +105,13 @@
         #define vTaskPrioritySet                         MPU_vTaskPrioritySet
         #define xTaskGetHandle                           MPU_xTaskGetHandle
         #define xTaskCallApplicationTaskHook             MPU_xTaskCallApplicationTaskHook
+        #define vTaskPreemptionDisableBudgetSet          MPU_vTaskPreemptionDisableBudgetSet
+        #define xTaskPreemptionDisableBudgetGet          MPU_xTaskPreemptionDisableBudgetGet
+        #define vTaskTimeSliceSet                        MPU_vTaskTimeSliceSet
+        #define xTaskTimeSliceGet                        MPU_xTaskTimeSliceGet
+        #define vTaskFairShareWeightSet                  MPU_vTaskFairShareWeightSet
+        #define uxTaskFairShareWeightGet                 MPU_uxTaskFairShareWeightGet
+        #define vTaskSetBlockTimeLimit                   MPU_vTaskSetBlockTimeLimit
 
         #if ( configUSE_MPU_WRAPPERS_V1 == 0 )
             #define pcTaskGetName                        MPU_pcTaskGetName
@@ -117,6 +126,7 @@
             #define xTaskGetApplicationTaskTagFromISR    MPU_xTaskGetApplicationTaskTagFromISR
             #define xTaskGenericNotifyFromISR            MPU_xTaskGenericNotifyFromISR
             #define vTaskGenericNotifyGiveFromISR        MPU_vTaskGenericNotifyGiveFromISR
+            #define xTaskNotifyMultipleFromISR           MPU_xTaskNotifyMultipleFromISR
         #endif /* #if ( configUSE_MPU_WRAPPERS_V1 == 0 ) */
 
 /* Map standard queue.h API functions to the MPU equivalents. */
@@ -147,6 +157,7 @@
         #define xQueueCreateCountingSemaphore          MPU_xQueueCreateCountingSemaphore
         #define xQueueCreateCountingSemaphoreStatic    MPU_xQueueCreateCountingSemaphoreStatic
         #define xQueueGenericCreate                    MPU_xQueueGenericCreate
+        #define xQueueCreatePriority                   MPU_xQueueCreatePriority
         #define xQueueGenericCreateStatic              MPU_xQueueGenericCreateStatic
         #define xQueueGenericReset                     MPU_xQueueGenericReset
         #define xQueueCreateSet                        MPU_xQueueCreateSet
@@ -164,6 +175,8 @@
             #define uxQueueMessagesWaitingFromISR      MPU_uxQueueMessagesWaitingFromISR
             #define xQueueGetMutexHolderFromISR        MPU_xQueueGetMutexHolderFromISR
             #define xQueueSelectFromSetFromISR         MPU_xQueueSelectFromSetFromISR
+            #define xQueuePeekInPlace                  MPU_xQueuePeekInPlace
+            #define xQueueReleaseInPlace               MPU_xQueueReleaseInPlace
         #endif /* if ( configUSE_MPU_WRAPPERS_V1 == 0 ) */
 
 /* Map standard timer.h API functions to the MPU equivalents. */
@@ -209,6 +209,17 @@ void xPortResetHeapMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
  */
 void vPortHeapResetState( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Adds the heap's control variables and free block list to a snapshot being
+ * written by xTaskWriteSnapshot().  Provided by heap_4.c and heap_5.c.  The
+ * other heap implementations fail to build if configKERNEL_SNAPSHOT_INCLUDE_HEAP
+ * is 1.
+ */
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) )
+    struct xSNAPSHOT_WRITER;
+    void vPortWriteHeapSnapshot( struct xSNAPSHOT_WRITER * pxWriter ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
 
 /**
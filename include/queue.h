@@ -68,6 +68,7 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueSEND_TO_BACK                     ( ( BaseType_t ) 0 )
 #define queueSEND_TO_FRONT                    ( ( BaseType_t ) 1 )
 #define queueOVERWRITE                        ( ( BaseType_t ) 2 )
+#define queueSEND_WITH_PRIORITY( uxPriority )    ( ( BaseType_t ) 3 + ( BaseType_t ) ( uxPriority ) )
 
 /* For internal use only.  These definitions *must* match those in queue.c. */
 #define queueQUEUE_TYPE_BASE                  ( ( uint8_t ) 0U )
@@ -76,6 +77,7 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE      ( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX       ( ( uint8_t ) 4U )
 #define queueQUEUE_TYPE_SET                   ( ( uint8_t ) 5U )
+#define queueQUEUE_TYPE_PRIORITY              ( ( uint8_t ) 6U )
 
 /**
  * queue. h
@@ -149,6 +151,86 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
     #define xQueueCreate( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_BASE ) )
 #endif
 
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreatePriority(
+ *                            UBaseType_t uxQueueLength,
+ *                            UBaseType_t uxItemSize,
+ *                            UBaseType_t uxNumberOfPriorities
+ *                        );
+ * @endcode
+ *
+ * Creates a new priority queue and returns a handle by which the queue can be
+ * referenced.  configUSE_PRIORITY_QUEUES must be set to 1 in FreeRTOSConfig.h
+ * for this function to be available.
+ *
+ * Each message posted to a priority queue using xQueueSendWithPriority() or
+ * xQueueSendWithPriorityFromISR() carries a priority from 0 to
+ * ( uxNumberOfPriorities - 1 ).  Receiving from the queue returns the message
+ * with the highest priority, where higher numbers denote more urgent
+ * messages, as with task priorities.  Messages of equal priority are received
+ * in the order they were sent.  Messages posted with xQueueSend() or
+ * xQueueSendToBack() have priority 0.  A priority queue cannot be posted to the
+ * front of, or overwritten, and cannot be used with xQueuePeekInPlace().
+ *
+ * Otherwise a priority queue is used exactly as any other queue, with the same
+ * blocking and interrupt safe API, including the co-routine API.  Posting a
+ * message with a priority to a queue that was not created by
+ * xQueueCreatePriority() is trapped by configASSERT().  Posting a message
+ * takes a constant time.  Receiving a message takes a time that does not
+ * depend on the number of messages in the queue, and is also constant when
+ * uxNumberOfPriorities is no greater than the number of bits in a
+ * UBaseType_t.  Beyond that, receiving checks one more UBaseType_t for each
+ * further group of that many priorities.
+ *
+ * Priority queues are always allocated from the FreeRTOS heap.  The
+ * allocation holds the queue storage area plus ( uxQueueLength +
+ * ( 2 * uxNumberOfPriorities ) ) UBaseType_t indexes used to order the
+ * messages, and a bitmap of one bit per priority rounded up to a whole number
+ * of UBaseType_t.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @param uxNumberOfPriorities The number of distinct message priorities.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * Example usage:
+ * @code{c}
+ * #define mainCOMMAND_PRIORITIES    4
+ *
+ * void vATask( void *pvParameters )
+ * {
+ * QueueHandle_t xCommandQueue;
+ * Command_t xCommand;
+ *
+ *  // Create a queue capable of containing 10 Command_t values, each of which
+ *  // can have one of mainCOMMAND_PRIORITIES priorities.
+ *  xCommandQueue = xQueueCreatePriority( 10, sizeof( Command_t ), mainCOMMAND_PRIORITIES );
+ *
+ *  // ...
+ *
+ *  // Post an urgent command.  It will be received before any less urgent
+ *  // commands that are already waiting in the queue.
+ *  xQueueSendWithPriority( xCommandQueue, &xCommand, mainCOMMAND_PRIORITIES - 1, 0 );
+ *
+ *  // ... Rest of task code.
+ * }
+ * @endcode
+ * \defgroup xQueueCreatePriority xQueueCreatePriority
+ * \ingroup QueueManagement
+ */
+#if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreatePriority( const UBaseType_t uxQueueLength,
+                                        const UBaseType_t uxItemSize,
+                                        const UBaseType_t uxNumberOfPriorities ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -597,6 +679,50 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define xQueueOverwrite( xQueue, pvItemToQueue ) \
     xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), 0, queueOVERWRITE )
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueSendWithPriority(
+ *                                    QueueHandle_t xQueue,
+ *                                    const void * pvItemToQueue,
+ *                                    UBaseType_t uxPriority,
+ *                                    TickType_t xTicksToWait
+ *                                );
+ * @endcode
+ *
+ * This is a macro that calls xQueueGenericSend().
+ *
+ * Post an item with a priority to a queue created by xQueueCreatePriority().
+ * The item will be received ahead of any items of a lower priority, and after
+ * any items of the same or a higher priority, that are already in the queue.
+ * The item is queued by copy, not by reference.  This function must not be
+ * called from an interrupt service routine.  See
+ * xQueueSendWithPriorityFromISR() for an alternative which may be used in an
+ * ISR.
+ *
+ * @param xQueue The handle to the priority queue on which the item is to be
+ * posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param uxPriority The priority of the item, which must be less than the
+ * number of priorities the queue was created with.  Higher numbers denote more
+ * urgent items.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it already
+ * be full.  The call will return immediately if this is set to 0 and the
+ * queue is full.
+ *
+ * @return pdPASS if the item was successfully posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendWithPriority xQueueSendWithPriority
+ * \ingroup QueueManagement
+ */
+#define xQueueSendWithPriority( xQueue, pvItemToQueue, uxPriority, xTicksToWait ) \
+    xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), ( xTicksToWait ), queueSEND_WITH_PRIORITY( uxPriority ) )
+
 
 /**
  * queue. h
@@ -820,6 +946,123 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
                               void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueuePeekInPlace(
+ *                                  QueueHandle_t xQueue,
+ *                                  void ** const ppvItems,
+ *                                  UBaseType_t * const puxItemsAvailable,
+ *                                  TickType_t xTicksToWait
+ *                              );
+ * @endcode
+ *
+ * Obtain a pointer to the items at the front of a queue without copying
+ * them out of the queue's storage area.  Use with xQueueReleaseInPlace()
+ * to process large items, for example frames held in a statically
+ * allocated queue, where they are stored.
+ *
+ * The items remain on the queue, and the space they occupy remains
+ * unavailable to senders, until they are released by a call to
+ * xQueueReleaseInPlace().  The items may then be overwritten at any time,
+ * so the pointer must not be used after they have been released.
+ *
+ * The items are consumed from the front of the queue, so the queue must have
+ * a single reader, and that reader must not mix this function with
+ * xQueueReceive().  Items must not be posted to the front of the queue
+ * (xQueueSendToFront(), xQueueOverwrite()) while any items are held.
+ *
+ * This function must not be used in an interrupt service routine, and must
+ * not be used on a queue that is used as a semaphore or mutex.
+ *
+ * The pointer refers to the queue's own storage area, which an unprivileged
+ * task cannot normally access, so when the MPU wrappers are used this
+ * function and xQueueReleaseInPlace() can only be called from privileged
+ * tasks.
+ *
+ * @param xQueue The handle to the queue from which items are to be
+ * obtained.
+ *
+ * @param ppvItems Set to point to the first item in the queue's storage area.
+ * Further items, if any, follow it at intervals of the queue's item size.
+ *
+ * @param puxItemsAvailable Set to the number of items that can be accessed
+ * through *ppvItems.  This can be less than the number of items in the queue
+ * when the items wrap around the end of the storage area, in which case the
+ * remaining items are returned by the next call once these have been
+ * released.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item should the queue be empty at the time of the call.
+ * xQueuePeekInPlace() will return immediately if xTicksToWait is 0 and the
+ * queue is empty.
+ *
+ * @return pdPASS if at least one item is available, otherwise
+ * errQUEUE_EMPTY.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAFrameProcessingTask( void *pvParameters )
+ * {
+ * void *pvFrames;
+ * UBaseType_t uxFrames, x;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueuePeekInPlace( xFrameQueue, &pvFrames, &uxFrames, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          for( x = 0; x < uxFrames; x++ )
+ *          {
+ *              vProcessFrame( &( ( Frame_t * ) pvFrames )[ x ] );
+ *          }
+ *
+ *          // The frames are finished with, so make their space available
+ *          // to the senders again.
+ *          xQueueReleaseInPlace( xFrameQueue, uxFrames );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueuePeekInPlace xQueuePeekInPlace
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueuePeekInPlace( QueueHandle_t xQueue,
+                              void ** const ppvItems,
+                              UBaseType_t * const puxItemsAvailable,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReleaseInPlace(
+ *                                     QueueHandle_t xQueue,
+ *                                     UBaseType_t uxItemsToRelease
+ *                                 );
+ * @endcode
+ *
+ * Remove items previously obtained with xQueuePeekInPlace() from the front of
+ * a queue, making their space available to senders again.  One task that is
+ * blocked waiting to send to the queue is unblocked for each item released.
+ *
+ * Fewer items than were returned by xQueuePeekInPlace() can be released, in
+ * which case the remainder stay at the front of the queue.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * removed.
+ *
+ * @param uxItemsToRelease The number of items to remove from the front of
+ * the queue.
+ *
+ * @return pdPASS if the items were removed.  pdFAIL if uxItemsToRelease is
+ * zero or greater than the number of items in the queue, in which case
+ * nothing is removed.
+ *
+ * \defgroup xQueueReleaseInPlace xQueueReleaseInPlace
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReleaseInPlace( QueueHandle_t xQueue,
+                                 UBaseType_t uxItemsToRelease ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * @code{c}
@@ -1109,6 +1352,46 @@ void vQueueDelete( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 #define xQueueSendToBackFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) \
     xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueSEND_TO_BACK )
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueSendWithPriorityFromISR(
+ *                                           QueueHandle_t xQueue,
+ *                                           const void *pvItemToQueue,
+ *                                           UBaseType_t uxPriority,
+ *                                           BaseType_t *pxHigherPriorityTaskWoken
+ *                                       );
+ * @endcode
+ *
+ * This is a macro that calls xQueueGenericSendFromISR().
+ *
+ * A version of xQueueSendWithPriority() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xQueue The handle to the priority queue on which the item is to be
+ * posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param uxPriority The priority of the item, which must be less than the
+ * number of priorities the queue was created with.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendWithPriorityFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending to the queue caused a task
+ * to unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendWithPriorityFromISR() sets this value to pdTRUE
+ * then a context switch should be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the data was successfully sent to the queue, otherwise
+ * errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendWithPriorityFromISR xQueueSendWithPriorityFromISR
+ * \ingroup QueueManagement
+ */
+#define xQueueSendWithPriorityFromISR( xQueue, pvItemToQueue, uxPriority, pxHigherPriorityTaskWoken ) \
+    xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueSEND_WITH_PRIORITY( uxPriority ) )
+
 /**
  * queue. h
  * @code{c}
@@ -1861,6 +2144,14 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
 UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Adds the queue registry, and each queue in it, to a
+ * snapshot being written by xTaskWriteSnapshot().
+ */
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) )
+    void vQueueWriteSnapshot( SnapshotWriter_t * pxWriter ) PRIVILEGED_FUNCTION;
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -101,6 +101,14 @@ typedef const struct tskTaskControlBlock   * ConstTaskHandle_t;
  */
 typedef BaseType_t (* TaskHookFunction_t)( void * arg );
 
+/*
+ * Defines the prototype to which the row callback passed to
+ * vTaskListTasksStreaming() and vTaskGetRunTimeStatisticsStreaming() must
+ * conform.
+ */
+typedef void (* TaskStatsRowCallbackFunction_t)( const char * pcRow,
+                                                 void * pvContext );
+
 /* Task states returned by eTaskGetState. */
 typedef enum
 {
@@ -122,6 +130,15 @@ typedef enum
     eSetValueWithoutOverwrite /* Set the task's notification value if the previous value has been read by the task. */
 } eNotifyAction;
 
+/* Describes a single notification sent by xTaskNotifyMultipleFromISR(). */
+typedef struct xTASK_NOTIFY_TARGET
+{
+    TaskHandle_t xTaskToNotify;  /* The handle of the task being notified. */
+    UBaseType_t uxIndexToNotify; /* The index within the task's array of notification values to which the notification is sent. */
+    uint32_t ulValue;            /* Data sent with the notification, used as described by eAction. */
+    eNotifyAction eAction;       /* How the notification updates the task's notification value. */
+} TaskNotifyTarget_t;
+
 /*
  * Used internally only.
  */
@@ -191,6 +208,122 @@ typedef enum
     #endif /* INCLUDE_vTaskSuspend */
 } eSleepModeStatus;
 
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+/* The reasons vApplicationDeadlockHook() is called. */
+    typedef enum
+    {
+        eMutexDeadlock = 0,     /* Each task in the chain is waiting for a mutex held by the next, and the last is waiting for a mutex held by the first. */
+        eBlockTimeLimitExceeded /* The first task in the chain has been blocked for longer than its block time limit.  The rest of the chain holds the mutexes it is waiting for, if any. */
+    } eDeadlockReport;
+
+/* One link in the chain of tasks passed to vApplicationDeadlockHook(). */
+    typedef struct xTASK_WAIT_LINK
+    {
+        TaskHandle_t xTask;       /* The handle of the task. */
+        void * pvMutex;           /* The mutex the task is waiting for, which is held by the next task in the chain.  NULL if the task is not waiting for a mutex. */
+        TickType_t xTicksBlocked; /* The number of ticks the task has been waiting for, or 0 if the task is not waiting for anything. */
+    } TaskWaitLink_t;
+#endif /* configUSE_DEADLOCK_DETECTION */
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+/* Identifies a snapshot written by xTaskWriteSnapshot(), and the byte order of
+ * the target. */
+    #define tskSNAPSHOT_MAGIC            ( ( uint32_t ) 0x46525353UL )
+    #define tskSNAPSHOT_VERSION          ( ( uint8_t ) 1U )
+
+/* The types of the records in a snapshot. */
+    #define tskSNAPSHOT_RECORD_START     ( ( uint32_t ) 1UL )
+    #define tskSNAPSHOT_RECORD_MEMORY    ( ( uint32_t ) 2UL )
+    #define tskSNAPSHOT_RECORD_TASK      ( ( uint32_t ) 3UL )
+    #define tskSNAPSHOT_RECORD_END       ( ( uint32_t ) 4UL )
+
+/* The kinds of memory held by tskSNAPSHOT_RECORD_MEMORY records. */
+    #define tskSNAPSHOT_MEMORY_KERNEL    ( ( uint32_t ) 1UL )
+    #define tskSNAPSHOT_MEMORY_TCB       ( ( uint32_t ) 2UL )
+    #define tskSNAPSHOT_MEMORY_STACK     ( ( uint32_t ) 3UL )
+    #define tskSNAPSHOT_MEMORY_QUEUE     ( ( uint32_t ) 4UL )
+    #define tskSNAPSHOT_MEMORY_TIMER     ( ( uint32_t ) 5UL )
+    #define tskSNAPSHOT_MEMORY_HEAP      ( ( uint32_t ) 6UL )
+
+/* Set in the flags of the tskSNAPSHOT_RECORD_END record if the buffer was too
+ * small to hold every record. */
+    #define tskSNAPSHOT_TRUNCATED        ( ( uint32_t ) 1UL )
+
+/* Holds the state of a snapshot while it is being written.  For internal use
+ * only. */
+    typedef struct xSNAPSHOT_WRITER
+    {
+        uint8_t * pucBuffer;  /* The buffer the snapshot is written to. */
+        size_t xBufferSize;   /* The size of the buffer, less the space reserved for the end record. */
+        size_t xBytesWritten; /* The number of bytes written to the buffer so far. */
+        BaseType_t xTruncated; /* Set to pdTRUE when a record does not fit in the buffer, after which no more records are written. */
+    } SnapshotWriter_t;
+#endif /* configUSE_KERNEL_SNAPSHOT */
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+/* The kernel locks of SMP FreeRTOS, see portGET_TASK_LOCK() and
+ * portGET_ISR_LOCK(). */
+    typedef enum
+    {
+        eTaskLock = 0, /* The lock held while the scheduler is suspended or a task is in a critical section. */
+        eISRLock       /* The lock held while a task or interrupt is in a critical section. */
+    } eKernelLock;
+
+/* The places in the kernel that acquire the kernel locks. */
+    typedef enum
+    {
+        eLockSiteEnterCritical = 0,    /* vTaskEnterCritical(). */
+        eLockSiteEnterCriticalFromISR, /* vTaskEnterCriticalFromISR(). */
+        eLockSiteSuspendAll,           /* vTaskSuspendAll(). */
+        eLockSiteSwitchContext,        /* vTaskSwitchContext(). */
+        eLockSiteRunStateChange        /* Reacquiring the locks after yielding on entry to a critical section or on suspending the scheduler. */
+    } eLockSite;
+
+/* Used with vTaskGetLockStatistics() to return the statistics of one kernel
+ * lock acquired at one place in the kernel.  Times are in the units of
+ * portGET_LOCK_STATISTICS_TIMESTAMP(). */
+    typedef struct xLOCK_STATISTICS
+    {
+        uint32_t ulAcquisitions;                      /* The number of times the lock was acquired while not already held by the acquiring core. */
+        configRUN_TIME_COUNTER_TYPE ulTotalWaitTime;  /* The total time spent waiting for the lock, which is the time spent spinning if the lock was held by another core. */
+        configRUN_TIME_COUNTER_TYPE ulMaxWaitTime;    /* The longest time spent waiting for the lock. */
+        configRUN_TIME_COUNTER_TYPE ulTotalHoldTime;  /* The total time the lock was held for, including the time it was held recursively. */
+        configRUN_TIME_COUNTER_TYPE ulMaxHoldTime;    /* The longest time the lock was held for. */
+    } LockStatistics_t;
+#endif /* ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+/* Used with vTaskGetPreemptionDisableStatistics() to return how long tasks kept
+ * preemption disabled, and how long that delayed the preemption of those tasks
+ * by higher priority tasks.  Times are in ticks. */
+    typedef struct xPREEMPTION_DISABLE_STATISTICS
+    {
+        UBaseType_t uxWindows;              /* The number of times a task enabled preemption again, or had it enabled by the overrun hook. */
+        TickType_t xLongestWindow;          /* The longest time a task kept preemption disabled. */
+        UBaseType_t uxOverruns;             /* The number of times a task kept preemption disabled for longer than its budget. */
+        UBaseType_t uxDelayedPreemptions;   /* The number of windows during which a higher priority task was ready but could not run because of the disabled preemption. */
+        TickType_t xTotalPreemptionDelay;   /* The total time from a higher priority task first being kept waiting to the end of the window. */
+        TickType_t xLongestPreemptionDelay; /* The longest such time. */
+    } PreemptionDisableStatistics_t;
+#endif /* configUSE_PREEMPTION_DISABLE_BUDGET */
+
+/*
+ * The type of the value held for a task that is waiting in an unordered event
+ * list, such as a task waiting for bits in an event group.  It matches
+ * TickType_t unless 64-bit event groups are used with a narrower TickType_t, in
+ * which case the value is held in the task's TCB instead of in the value of its
+ * event list item.
+ */
+#if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+    typedef uint64_t     EventItemValue_t;
+#else
+    typedef TickType_t   EventItemValue_t;
+#endif
+
 /**
  * Defines the priority used by the idle task.  This must not be modified.
  *
@@ -205,6 +338,14 @@ typedef enum
  */
 #define tskNO_AFFINITY      ( ( UBaseType_t ) -1 )
 
+/**
+ * Defines the weight given to tasks at configFAIR_SHARE_PRIORITY when they are
+ * created.  See vTaskFairShareWeightSet().
+ *
+ * \ingroup TaskUtils
+ */
+#define tskDEFAULT_FAIR_SHARE_WEIGHT    ( ( UBaseType_t ) 16U )
+
 /**
  * task. h
  *
@@ -1483,6 +1624,325 @@ BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
     void vTaskPreemptionEnable( const TaskHandle_t xTask );
 #endif
 
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+/**
+ * @brief Sets the longest time a task may keep preemption disabled.
+ *
+ * The budget is measured from the call to vTaskPreemptionDisable().  If the
+ * task is still running with preemption disabled once the budget has been
+ * used up, the tick interrupt calls xApplicationPreemptionDisableOverrunHook(),
+ * once per window, which can enable preemption for the task again.  New tasks
+ * are given a budget of configDEFAULT_PREEMPTION_DISABLE_BUDGET ticks.
+ *
+ * configUSE_PREEMPTION_DISABLE_BUDGET must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * @param xTask The handle of the task to set the budget of.  Passing NULL sets
+ * the budget of the calling task.
+ *
+ * @param xTicks The budget in ticks, or 0 for no limit.  A new budget applies to
+ * a window that is already open.
+ */
+    void vTaskPreemptionDisableBudgetSet( TaskHandle_t xTask,
+                                          TickType_t xTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * @brief Gets the budget set by vTaskPreemptionDisableBudgetSet().
+ *
+ * @param xTask The handle of the task to query.  Passing NULL queries the
+ * calling task.
+ *
+ * @return The budget in ticks, or 0 if the task has no limit.
+ */
+    TickType_t xTaskPreemptionDisableBudgetGet( ConstTaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * @brief Gets the statistics of the windows in which tasks had preemption
+ * disabled.
+ *
+ * A window is accounted for when it ends.  A higher priority task is counted as
+ * kept waiting when it becomes ready and every core it could have preempted
+ * is running a task with preemption disabled, and the delay is charged to the
+ * window of the task on one of those cores.  The statistics therefore measure
+ * the latency added by vTaskPreemptionDisable(), to tick resolution, so it can
+ * be checked against the latency the application can tolerate.
+ *
+ * configUSE_PREEMPTION_DISABLE_BUDGET must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * @param pxStatistics Used to return the statistics.
+ */
+    void vTaskGetPreemptionDisableStatistics( PreemptionDisableStatistics_t * pxStatistics ) PRIVILEGED_FUNCTION;
+
+/**
+ * @brief Clears the statistics returned by
+ * vTaskGetPreemptionDisableStatistics().
+ *
+ * configUSE_PREEMPTION_DISABLE_BUDGET must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ */
+    void vTaskResetPreemptionDisableStatistics( void ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_PREEMPTION_DISABLE_BUDGET */
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+/**
+ * @brief Sets the length of a task's time slice.
+ *
+ * When more than one ready task shares the highest ready priority, the
+ * scheduler switches between them on the tick interrupt.  By default each
+ * task runs for configDEFAULT_TIME_SLICE_LENGTH ticks before the next task of
+ * the same priority is selected.  Giving CPU bound tasks a longer time slice
+ * reduces the number of context switches between them, while tasks of equal
+ * priority that are given different time slice lengths share the processor in
+ * proportion to those lengths.
+ *
+ * A task that blocks starts a full time slice when it next runs.  A task that
+ * is preempted by a higher priority task, or that yields, keeps the rest of
+ * its current time slice.
+ *
+ * configUSE_TIME_SLICE_LENGTH must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  The time slice length has no effect on
+ * preemption by higher priority tasks.
+ *
+ * @param xTask The handle of the task to set the time slice length of.
+ * Passing NULL sets the time slice length of the calling task.
+ *
+ * @param xTicks The number of ticks the task runs for in each time slice.
+ * Must be at least 1.
+ *
+ * Example usage:
+ *
+ * void vBatchWorker( void *pvParameters )
+ * {
+ *     // Run for 20 ticks at a time when time sliced with other tasks of the
+ *     // same priority.
+ *     vTaskTimeSliceSet( NULL, 20 );
+ *
+ *     for( ;; )
+ *     {
+ *         // ... Perform some lengthy processing here.
+ *     }
+ * }
+ */
+    void vTaskTimeSliceSet( TaskHandle_t xTask,
+                            TickType_t xTicks ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+/**
+ * @brief Gets the length of a task's time slice.
+ *
+ * @param xTask The handle of the task to get the time slice length of.
+ * Passing NULL gets the time slice length of the calling task.
+ *
+ * @return The number of ticks the task runs for in each time slice.
+ */
+    TickType_t xTaskTimeSliceGet( ConstTaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+/**
+ * @brief Sets a task's share of the processor within the fair share class.
+ *
+ * Ready tasks at configFAIR_SHARE_PRIORITY are not scheduled round robin.
+ * Instead the kernel tracks the processor time each of them has used, divided
+ * by its weight, and always runs the one that has used the least.  Tasks of
+ * the fair share class therefore share the processor in proportion to their
+ * weights, whatever their time slice and however often they block.  Tasks are
+ * created with a weight of tskDEFAULT_FAIR_SHARE_WEIGHT.
+ *
+ * The Ready state tasks of the class are kept in order of the processor time
+ * they have used, so making one of them ready, including from an interrupt,
+ * takes time proportional to the number of them that are already ready, rather
+ * than constant time.  This happens within a critical section.
+ *
+ * configUSE_FAIR_SHARE_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.  The weight only has an effect while the task's
+ * priority is configFAIR_SHARE_PRIORITY.
+ *
+ * @param xTask The handle of the task to set the weight of.  Passing NULL sets
+ * the weight of the calling task.
+ *
+ * @param uxWeight The task's weight, from 1 to 0xFFFF.  A task with twice the
+ * weight of another receives twice as much processor time.
+ *
+ * Example usage:
+ *
+ * void vStartBackgroundWork( void )
+ * {
+ *     TaskHandle_t xLogger, xIndexer;
+ *
+ *     xTaskCreate( vLoggerTask, "Log", 200, NULL, configFAIR_SHARE_PRIORITY, &xLogger );
+ *     xTaskCreate( vIndexerTask, "Idx", 200, NULL, configFAIR_SHARE_PRIORITY, &xIndexer );
+ *
+ *     // The indexer receives three times as much of the processor time left
+ *     // over by higher priority tasks as the logger.
+ *     vTaskFairShareWeightSet( xIndexer, tskDEFAULT_FAIR_SHARE_WEIGHT * 3 );
+ * }
+ */
+    void vTaskFairShareWeightSet( TaskHandle_t xTask,
+                                  UBaseType_t uxWeight ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+/**
+ * @brief Gets a task's weight within the fair share class.
+ *
+ * @param xTask The handle of the task to get the weight of.  Passing NULL gets
+ * the weight of the calling task.
+ *
+ * @return The weight of the task.
+ */
+    UBaseType_t uxTaskFairShareWeightGet( ConstTaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+/**
+ * @brief Sets the longest time a task is expected to wait for an event.
+ *
+ * If the task waits for a queue, semaphore, mutex, event group, notification
+ * or other event for longer than xBlockTimeLimit ticks then the deadlock
+ * detector calls vApplicationDeadlockHook() with eBlockTimeLimitExceeded.
+ * Each wait is reported at most once.  Time spent in vTaskDelay() is not
+ * considered to be waiting.  Tasks are created without a block time limit.
+ *
+ * configUSE_DEADLOCK_DETECTION must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xTask The handle of the task to set the block time limit of.  Passing
+ * NULL sets the block time limit of the calling task.
+ *
+ * @param xBlockTimeLimit The block time limit in ticks, or 0 to remove the
+ * task's block time limit.
+ */
+    void vTaskSetBlockTimeLimit( TaskHandle_t xTask,
+                                 TickType_t xBlockTimeLimit ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+/**
+ * @brief Checks the waiting tasks for deadlocks and exceeded block time limits.
+ *
+ * Follows the chain of mutex holders from each task that is waiting for a
+ * mutex, and calls vApplicationDeadlockHook() with eMutexDeadlock if the chain
+ * leads back to the task.  Also calls vApplicationDeadlockHook() with
+ * eBlockTimeLimitExceeded for each task that has been waiting for longer than
+ * the limit set by vTaskSetBlockTimeLimit().  The check runs with the
+ * scheduler suspended, and takes time proportional to the number of Blocked
+ * and Suspended tasks.
+ *
+ * The idle task calls this function every configDEADLOCK_DETECTION_PERIOD
+ * ticks.  Set configDEADLOCK_DETECTION_PERIOD to 0 to call it from the
+ * application instead, for example from a task or software timer that does not
+ * depend on the idle task running.
+ *
+ * configUSE_DEADLOCK_DETECTION must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ */
+    void vTaskCheckForDeadlocks( void ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+/**
+ * @brief Writes a snapshot of the kernel state to a buffer.
+ *
+ * Intended to be called from a fault handler, to preserve the kernel state in
+ * a reserved area of RAM for analysis after a reset.  Unlike
+ * uxTaskGetSystemState() it neither suspends the scheduler nor enters a
+ * critical section, and it does not allocate memory, so it can be called when
+ * the kernel is not in a consistent state.  The walk of each kernel list is
+ * bounded by the length recorded in the list.
+ *
+ * The snapshot is a stream of records in the byte order of the target.  Each
+ * record starts with a uint32_t type followed by a uint32_t length, which is
+ * the number of bytes of data that follow.  There is no padding between
+ * records.  The data of each type of record is:
+ *
+ * tskSNAPSHOT_RECORD_START - always first.  A uint32_t holding
+ * tskSNAPSHOT_MAGIC, then eight uint8_t values: the snapshot version, the
+ * sizes of a pointer, TickType_t, UBaseType_t and StackType_t, 1 if stacks
+ * grow upwards else 0, configNUMBER_OF_CORES, and 0.
+ *
+ * tskSNAPSHOT_RECORD_MEMORY - a uint32_t tskSNAPSHOT_MEMORY_* kind, then the
+ * address the memory was copied from as a pointer sized value, then the bytes
+ * copied.  Kernel variables, TCBs, the used part of each stack, queues in the
+ * queue registry, active software timers and, if
+ * configKERNEL_SNAPSHOT_INCLUDE_HEAP is 1, the heap's free block list are
+ * copied.  A host tool can decode them using the symbols and type information
+ * of the application's executable, as it would a core file.
+ *
+ * tskSNAPSHOT_RECORD_TASK - the handle of a task as a pointer sized value, then
+ * its eTaskState as a uint32_t.  It is followed by memory records holding the
+ * task's TCB and, if the end of the stack is known (see
+ * configRECORD_STACK_HIGH_ADDRESS), the used part of its stack.
+ *
+ * tskSNAPSHOT_RECORD_END - always last.  A uint32_t holding the total number
+ * of bytes in the snapshot, then a uint32_t of flags - tskSNAPSHOT_TRUNCATED
+ * if the buffer was too small to hold every record.
+ *
+ * configUSE_KERNEL_SNAPSHOT must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param pvBuffer The buffer to write the snapshot to.
+ *
+ * @param xBufferSize The size of pvBuffer in bytes.
+ *
+ * @return The number of bytes written to pvBuffer, or 0 if pvBuffer is too
+ * small to hold the start and end records.
+ */
+    size_t xTaskWriteSnapshot( void * pvBuffer,
+                               size_t xBufferSize ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+/**
+ * @brief Gets the statistics of a kernel lock acquired at one place in the
+ * kernel.
+ *
+ * Each time the kernel acquires the task lock or the ISR lock it records how
+ * long it waited for the lock, and, when the lock is released, how long it was
+ * held.  Both times are attributed to the place the lock was acquired, so the
+ * kernel paths that hold the locks for longest, or contend for them most, can
+ * be found.  For example, the task lock acquired by vTaskSuspendAll() is held
+ * until xTaskResumeAll() releases it.  Acquiring a lock the core already holds
+ * is not counted.
+ *
+ * The statistics are updated while the lock they describe is held, so they
+ * add to the time the lock is held.  Time is measured with
+ * portGET_LOCK_STATISTICS_TIMESTAMP(), which should be a cycle counter to
+ * resolve short waits.
+ *
+ * configUSE_SMP_LOCK_STATISTICS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param eSite The place in the kernel the lock was acquired.
+ *
+ * @param eLock The lock to get the statistics of.
+ *
+ * @param pxLockStatistics Used to return the statistics.
+ */
+    void vTaskGetLockStatistics( eLockSite eSite,
+                                 eKernelLock eLock,
+                                 LockStatistics_t * pxLockStatistics ) PRIVILEGED_FUNCTION;
+
+/**
+ * @brief Clears the statistics of the kernel locks.
+ *
+ * configUSE_SMP_LOCK_STATISTICS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ */
+    void vTaskResetLockStatistics( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*-----------------------------------------------------------
 * SCHEDULER CONTROL
 *----------------------------------------------------------*/
@@ -1948,6 +2408,64 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationDeadlockHook( eDeadlockReport eReport, const TaskWaitLink_t * pxChain, UBaseType_t uxChainLength );
+ * @endcode
+ *
+ * The application deadlock hook is called by vTaskCheckForDeadlocks() when it
+ * finds a mutex deadlock or a task that has exceeded its block time limit.
+ * The hook is called with the scheduler suspended, so it MUST NOT CALL A
+ * FUNCTION THAT MIGHT BLOCK.  Unless configDEADLOCK_DETECTION_PERIOD is 0 the
+ * hook runs in the idle task, so the idle task's stack, set by
+ * configMINIMAL_STACK_SIZE, must be large enough for the hook.  pxChain is
+ * held in kernel memory, not on the stack, and is only valid until the hook
+ * returns.
+ *
+ * @param eReport What was found - see the definition of eDeadlockReport.
+ * @param pxChain The tasks involved.  Each task in the chain other than the
+ * last is waiting for a mutex held by the next task in the chain.  The chain is
+ * truncated to configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH tasks.
+ * @param uxChainLength The number of tasks in pxChain.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationDeadlockHook( eDeadlockReport eReport,
+                                   const TaskWaitLink_t * pxChain,
+                                   UBaseType_t uxChainLength );
+
+#endif
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * BaseType_t xApplicationPreemptionDisableOverrunHook( TaskHandle_t xTask );
+ * @endcode
+ *
+ * The application preemption disable overrun hook is called from the tick
+ * interrupt when a running task has kept preemption disabled for longer than
+ * its budget - see vTaskPreemptionDisableBudgetSet().  The hook is called
+ * inside a critical section, so it MUST NOT CALL A FREERTOS API FUNCTION.
+ *
+ * @param xTask The task that exceeded its budget.
+ *
+ * @return pdTRUE to enable preemption for the task, as if it had called
+ * vTaskPreemptionEnable(), or pdFALSE to leave preemption disabled and only
+ * record the overrun.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    BaseType_t xApplicationPreemptionDisableOverrunHook( TaskHandle_t xTask );
+
+#endif
+
 #if ( configUSE_IDLE_HOOK == 1 )
 
 /**
@@ -2247,6 +2765,61 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
                          size_t uxBufferLength ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskListTasksStreaming( TaskStatsRowCallbackFunction_t pxRowCallback, void *pvContext );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY and configUSE_STATS_FORMATTING_FUNCTIONS must
+ * both be defined as 1 for this function to be available.
+ *
+ * Generates the same table as vTaskListTasks(), but passes each row to
+ * pxRowCallback as soon as it has been formatted instead of writing the whole
+ * table into a caller supplied buffer.  No TaskStatus_t array is allocated, so
+ * the function does not use the FreeRTOS heap, and the stack it uses does not
+ * depend on the number of tasks.
+ *
+ * The scheduler is only suspended while the information for a single task is
+ * gathered, and is not suspended when pxRowCallback is called, so the callback
+ * can block (for example, while waiting for space in a UART buffer).  Rows are
+ * generated in the same order as vTaskListTasks() generates them.  A task that
+ * is created, deleted or changes state while the table is being generated may
+ * be missing from it, or may appear in it more than once.
+ *
+ * The position reached in the task lists is kept between rows, so each
+ * suspension normally takes a constant time.  Only if a task was created or
+ * deleted, or the task on the previous row changed state, while the callback
+ * ran is the current task list walked again to find the position, which takes
+ * time proportional to the number of tasks in that list.
+ *
+ * Example usage:
+ * @code{c}
+ * void vPrintRow( const char *pcRow, void *pvContext )
+ * {
+ *     ( void ) pvContext;
+ *     vConsoleWrite( pcRow );
+ * }
+ *
+ * void vListCommand( void )
+ * {
+ *     vTaskListTasksStreaming( vPrintRow, NULL );
+ * }
+ * @endcode
+ *
+ * @param pxRowCallback The function called with each null terminated row of
+ * the table.  Each row ends with "\r\n".
+ *
+ * @param pvContext Passed unchanged to pxRowCallback.
+ *
+ * \defgroup vTaskListTasksStreaming vTaskListTasksStreaming
+ * \ingroup TaskUtils
+ */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+    void vTaskListTasksStreaming( TaskStatsRowCallbackFunction_t pxRowCallback,
+                                  void * pvContext ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2372,6 +2945,35 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
                                     size_t uxBufferLength ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetRunTimeStatisticsStreaming( TaskStatsRowCallbackFunction_t pxRowCallback, void *pvContext );
+ * @endcode
+ *
+ * configGENERATE_RUN_TIME_STATS, configUSE_STATS_FORMATTING_FUNCTIONS and
+ * configUSE_TRACE_FACILITY must all be defined as 1 for this function to be
+ * available.
+ *
+ * Generates the same table as vTaskGetRunTimeStatistics(), but passes each row
+ * to pxRowCallback as soon as it has been formatted, in the same way as
+ * vTaskListTasksStreaming(), and with the same cost.  The total run time used
+ * to calculate the percentage on each row is sampled at the same time as that
+ * row's task run time counter.
+ *
+ * @param pxRowCallback The function called with each null terminated row of
+ * the table.  Each row ends with "\r\n".
+ *
+ * @param pvContext Passed unchanged to pxRowCallback.
+ *
+ * \defgroup vTaskGetRunTimeStatisticsStreaming vTaskGetRunTimeStatisticsStreaming
+ * \ingroup TaskUtils
+ */
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+    void vTaskGetRunTimeStatisticsStreaming( TaskStatsRowCallbackFunction_t pxRowCallback,
+                                             void * pvContext ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2814,6 +3416,61 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
 #define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) \
     xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskNotifyMultipleFromISR( const TaskNotifyTarget_t * pxTargets, UBaseType_t uxNumberOfTargets, BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * See https://www.FreeRTOS.org/RTOS-task-notifications.html for details.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Sends a batch of direct to task notifications from an interrupt service
+ * routine (ISR).  Each entry in the pxTargets array is processed exactly as if
+ * it had been passed to xTaskNotifyIndexedFromISR(), so eIncrement gives a
+ * notification in the same way as vTaskNotifyGiveIndexedFromISR() and eSetBits
+ * sets bits in the target's notification value.
+ *
+ * Calling xTaskNotifyMultipleFromISR() is more efficient than calling
+ * xTaskNotifyIndexedFromISR() once per task because all the notifications are
+ * sent from within a single interrupt masked section and the need for a context
+ * switch is evaluated only once, against the highest priority task unblocked by
+ * the batch.  In SMP builds each core is requested to yield at most once, no
+ * matter how many of the unblocked tasks it is selected to run.
+ *
+ * The same task may appear more than once in the array, in which case the
+ * notifications are applied in array order.  The time spent with interrupts
+ * masked grows with uxNumberOfTargets, so the batch size should be bounded by
+ * the application.
+ *
+ * @param pxTargets An array of uxNumberOfTargets TaskNotifyTarget_t structures,
+ * each of which holds the handle of a task to notify, the index within that
+ * task's array of notification values to which the notification is sent, and
+ * the ulValue and eAction parameters as documented for
+ * xTaskNotifyIndexedFromISR().
+ *
+ * @param uxNumberOfTargets The number of entries in the pxTargets array.
+ *
+ * @param pxHigherPriorityTaskWoken xTaskNotifyMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending any of the notifications
+ * caused a task to leave the Blocked state, and that task has a priority higher
+ * than the currently running task.  If xTaskNotifyMultipleFromISR() sets this
+ * value to pdTRUE then a context switch should be requested before the
+ * interrupt is exited.
+ *
+ * @return pdPASS if every notification was sent.  pdFAIL if any entry used the
+ * eSetValueWithoutOverwrite action and its target already had a notification
+ * pending - the remaining entries are still processed in that case.
+ *
+ * \defgroup xTaskNotifyMultipleFromISR xTaskNotifyMultipleFromISR
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskNotifyMultipleFromISR( const TaskNotifyTarget_t * pxTargets,
+                                       UBaseType_t uxNumberOfTargets,
+                                       BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * @code{c}
@@ -3534,7 +4191,7 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnEventList( List_t * const pxEventList,
                             const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
+                                     const EventItemValue_t xItemValue,
                                      const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 /*
@@ -3578,7 +4235,27 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
  */
 BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+                                        const EventItemValue_t xItemValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.
+ *
+ * A version of vTaskRemoveFromUnorderedEventList() that does not require the
+ * scheduler to be suspended, so can be called from an interrupt.  If the
+ * scheduler is suspended the task is held in the pending ready list until the
+ * scheduler is resumed.  Used by the event groups implementation when
+ * configUSE_EVENT_GROUPS_DIRECT_ISR is 1.
+ *
+ * @return pdTRUE if the task being removed has a higher priority than the task
+ * that was interrupted, otherwise pdFALSE.
+ */
+#if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 )
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const EventItemValue_t xItemValue ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
@@ -3598,7 +4275,19 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
  * THE EVENT BITS MODULE.
  */
-TickType_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
+EventItemValue_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS USED BY THE
+ * EVENT BITS MODULE.
+ *
+ * Returns the value held for the task that owns pxEventListItem while the task
+ * waits in an unordered event list.  Only required when the value is held in
+ * the task's TCB - otherwise it is the value of pxEventListItem itself.
+ */
+#if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+    EventItemValue_t uxTaskGetEventItemValue( const ListItem_t * pxEventListItem ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Return the handle of the calling task.
@@ -3697,6 +4386,45 @@ void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Records the mutex the calling task is about to block
+ * on, and where the handle of the mutex holder is stored, so the deadlock
+ * detector can follow the chain of mutex holders.  Called with NULL parameters
+ * once the task is no longer blocked on the mutex.
+ */
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+    void vTaskSetBlockingMutex( void * pvMutex,
+                                TaskHandle_t const * pxMutexHolder ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Adds a tskSNAPSHOT_RECORD_MEMORY record holding a
+ * copy of xLength bytes from pvAddress to the snapshot being written by
+ * xTaskWriteSnapshot().
+ */
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+    void vTaskSnapshotWriteMemory( SnapshotWriter_t * pxWriter,
+                                   uint32_t ulKind,
+                                   const void * pvAddress,
+                                   size_t xLength ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Adds each block of a heap's free block list, starting
+ * at pvFirstBlock, to the snapshot being written by xTaskWriteSnapshot().  Each
+ * block is xBlockSize bytes and starts with the pointer to the next block,
+ * XORed with uxPointerMask.  The list must be ordered by address and end at
+ * pvEnd.  The walk stops at the first block that is out of order, so a
+ * corrupted list is not followed indefinitely.
+ */
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) )
+    void vTaskSnapshotWriteFreeBlocks( SnapshotWriter_t * pxWriter,
+                                       const void * pvFirstBlock,
+                                       const void * pvEnd,
+                                       size_t xBlockSize,
+                                       portPOINTER_SIZE_TYPE uxPointerMask ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
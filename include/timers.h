@@ -1426,6 +1426,14 @@ BaseType_t xTimerGenericCommandFromISR( TimerHandle_t xTimer,
  */
 void vTimerResetState( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Adds the timer lists, and each active timer, to a
+ * snapshot being written by xTaskWriteSnapshot().
+ */
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+    void vTimerWriteSnapshot( SnapshotWriter_t * pxWriter ) PRIVILEGED_FUNCTION;
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
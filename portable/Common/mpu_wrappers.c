@@ -784,6 +784,220 @@
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        void MPU_vTaskPreemptionDisableBudgetSet( TaskHandle_t xTask,
+                                                  TickType_t xTicks ) /* FREERTOS_SYSTEM_CALL */
+        {
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                vTaskPreemptionDisableBudgetSet( xTask, xTicks );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                vTaskPreemptionDisableBudgetSet( xTask, xTicks );
+            }
+        }
+    #endif /* if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        TickType_t MPU_xTaskPreemptionDisableBudgetGet( ConstTaskHandle_t xTask ) /* FREERTOS_SYSTEM_CALL */
+        {
+            TickType_t xReturn;
+
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                xReturn = xTaskPreemptionDisableBudgetGet( xTask );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                xReturn = xTaskPreemptionDisableBudgetGet( xTask );
+            }
+
+            return xReturn;
+        }
+    #endif /* if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        void MPU_vTaskGetPreemptionDisableStatistics( PreemptionDisableStatistics_t * pxStatistics ) /* FREERTOS_SYSTEM_CALL */
+        {
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                vTaskGetPreemptionDisableStatistics( pxStatistics );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                vTaskGetPreemptionDisableStatistics( pxStatistics );
+            }
+        }
+    #endif /* if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        void MPU_vTaskResetPreemptionDisableStatistics( void ) /* FREERTOS_SYSTEM_CALL */
+        {
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                vTaskResetPreemptionDisableStatistics();
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                vTaskResetPreemptionDisableStatistics();
+            }
+        }
+    #endif /* if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+        void MPU_vTaskTimeSliceSet( TaskHandle_t xTask,
+                                    TickType_t xTicks ) /* FREERTOS_SYSTEM_CALL */
+        {
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                vTaskTimeSliceSet( xTask, xTicks );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                vTaskTimeSliceSet( xTask, xTicks );
+            }
+        }
+    #endif /* if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+        TickType_t MPU_xTaskTimeSliceGet( ConstTaskHandle_t xTask ) /* FREERTOS_SYSTEM_CALL */
+        {
+            TickType_t xReturn;
+
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                xReturn = xTaskTimeSliceGet( xTask );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                xReturn = xTaskTimeSliceGet( xTask );
+            }
+
+            return xReturn;
+        }
+    #endif /* if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+        void MPU_vTaskFairShareWeightSet( TaskHandle_t xTask,
+                                          UBaseType_t uxWeight ) /* FREERTOS_SYSTEM_CALL */
+        {
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                vTaskFairShareWeightSet( xTask, uxWeight );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                vTaskFairShareWeightSet( xTask, uxWeight );
+            }
+        }
+    #endif /* if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+        UBaseType_t MPU_uxTaskFairShareWeightGet( ConstTaskHandle_t xTask ) /* FREERTOS_SYSTEM_CALL */
+        {
+            UBaseType_t uxReturn;
+
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                uxReturn = uxTaskFairShareWeightGet( xTask );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                uxReturn = uxTaskFairShareWeightGet( xTask );
+            }
+
+            return uxReturn;
+        }
+    #endif /* if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        void MPU_vTaskSetBlockTimeLimit( TaskHandle_t xTask,
+                                         TickType_t xBlockTimeLimit ) /* FREERTOS_SYSTEM_CALL */
+        {
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                vTaskSetBlockTimeLimit( xTask, xBlockTimeLimit );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                vTaskSetBlockTimeLimit( xTask, xBlockTimeLimit );
+            }
+        }
+    #endif /* if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
     #if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
         UBaseType_t MPU_uxTaskGetStackHighWaterMark( TaskHandle_t xTask ) /* FREERTOS_SYSTEM_CALL */
         {
@@ -1103,6 +1317,34 @@
     #endif /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
+    #if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        QueueHandle_t MPU_xQueueCreatePriority( UBaseType_t uxQueueLength,
+                                                UBaseType_t uxItemSize,
+                                                UBaseType_t uxNumberOfPriorities ) /* FREERTOS_SYSTEM_CALL */
+        {
+            QueueHandle_t xReturn;
+
+            if( portIS_PRIVILEGED() == pdFALSE )
+            {
+                portRAISE_PRIVILEGE();
+                portMEMORY_BARRIER();
+
+                xReturn = xQueueCreatePriority( uxQueueLength, uxItemSize, uxNumberOfPriorities );
+                portMEMORY_BARRIER();
+
+                portRESET_PRIVILEGE();
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                xReturn = xQueueCreatePriority( uxQueueLength, uxItemSize, uxNumberOfPriorities );
+            }
+
+            return xReturn;
+        }
+    #endif /* if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
         QueueHandle_t MPU_xQueueGenericCreateStatic( const UBaseType_t uxQueueLength,
                                                      const UBaseType_t uxItemSize,
@@ -118,6 +118,13 @@
  */
     #define mpuUINT32_MAX    ( ~( ( uint32_t ) 0 ) )
 
+/**
+ * @brief The number of targets MPU_xTaskNotifyMultipleFromISR() translates
+ * into internal task handles, on its stack, for each call to
+ * xTaskNotifyMultipleFromISR().
+ */
+    #define NOTIFY_MULTIPLE_BATCH_SIZE    ( ( UBaseType_t ) 8U )
+
 /**
  * @brief Check if multiplying a and b will result in overflow.
  */
@@ -1705,6 +1712,229 @@
     #endif /* if ( INCLUDE_vTaskPrioritySet == 1 ) */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+        void MPU_vTaskPreemptionDisableBudgetSet( TaskHandle_t xTask,
+                                                  TickType_t xTicks ) /* PRIVILEGED_FUNCTION */
+        {
+            TaskHandle_t xInternalTaskHandle = NULL;
+            int32_t lIndex;
+
+            if( xTask == NULL )
+            {
+                vTaskPreemptionDisableBudgetSet( xTask, xTicks );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        vTaskPreemptionDisableBudgetSet( xInternalTaskHandle, xTicks );
+                    }
+                }
+            }
+        }
+
+    #endif /* if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+        TickType_t MPU_xTaskPreemptionDisableBudgetGet( ConstTaskHandle_t xTask ) /* PRIVILEGED_FUNCTION */
+        {
+            TickType_t xReturn = 0;
+            int32_t lIndex;
+            TaskHandle_t xInternalTaskHandle = NULL;
+
+            if( xTask == NULL )
+            {
+                xReturn = xTaskPreemptionDisableBudgetGet( xTask );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        xReturn = xTaskPreemptionDisableBudgetGet( xInternalTaskHandle );
+                    }
+                }
+            }
+
+            return xReturn;
+        }
+
+    #endif /* if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+        void MPU_vTaskTimeSliceSet( TaskHandle_t xTask,
+                                    TickType_t xTicks ) /* PRIVILEGED_FUNCTION */
+        {
+            TaskHandle_t xInternalTaskHandle = NULL;
+            int32_t lIndex;
+
+            if( xTask == NULL )
+            {
+                vTaskTimeSliceSet( xTask, xTicks );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        vTaskTimeSliceSet( xInternalTaskHandle, xTicks );
+                    }
+                }
+            }
+        }
+
+    #endif /* if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+        TickType_t MPU_xTaskTimeSliceGet( ConstTaskHandle_t xTask ) /* PRIVILEGED_FUNCTION */
+        {
+            TickType_t xReturn = 0;
+            int32_t lIndex;
+            TaskHandle_t xInternalTaskHandle = NULL;
+
+            if( xTask == NULL )
+            {
+                xReturn = xTaskTimeSliceGet( xTask );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        xReturn = xTaskTimeSliceGet( xInternalTaskHandle );
+                    }
+                }
+            }
+
+            return xReturn;
+        }
+
+    #endif /* if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+        void MPU_vTaskFairShareWeightSet( TaskHandle_t xTask,
+                                          UBaseType_t uxWeight ) /* PRIVILEGED_FUNCTION */
+        {
+            TaskHandle_t xInternalTaskHandle = NULL;
+            int32_t lIndex;
+
+            if( xTask == NULL )
+            {
+                vTaskFairShareWeightSet( xTask, uxWeight );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        vTaskFairShareWeightSet( xInternalTaskHandle, uxWeight );
+                    }
+                }
+            }
+        }
+
+    #endif /* if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+        UBaseType_t MPU_uxTaskFairShareWeightGet( ConstTaskHandle_t xTask ) /* PRIVILEGED_FUNCTION */
+        {
+            UBaseType_t uxReturn = 0;
+            int32_t lIndex;
+            TaskHandle_t xInternalTaskHandle = NULL;
+
+            if( xTask == NULL )
+            {
+                uxReturn = uxTaskFairShareWeightGet( xTask );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        uxReturn = uxTaskFairShareWeightGet( xInternalTaskHandle );
+                    }
+                }
+            }
+
+            return uxReturn;
+        }
+
+    #endif /* if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+        void MPU_vTaskSetBlockTimeLimit( TaskHandle_t xTask,
+                                         TickType_t xBlockTimeLimit ) /* PRIVILEGED_FUNCTION */
+        {
+            TaskHandle_t xInternalTaskHandle = NULL;
+            int32_t lIndex;
+
+            if( xTask == NULL )
+            {
+                vTaskSetBlockTimeLimit( xTask, xBlockTimeLimit );
+            }
+            else
+            {
+                lIndex = ( int32_t ) xTask;
+
+                if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+                {
+                    xInternalTaskHandle = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+                    if( xInternalTaskHandle != NULL )
+                    {
+                        vTaskSetBlockTimeLimit( xInternalTaskHandle, xBlockTimeLimit );
+                    }
+                }
+            }
+        }
+
+    #endif /* if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
     #if ( INCLUDE_xTaskGetHandle == 1 )
 
         TaskHandle_t MPU_xTaskGetHandle( const char * pcNameToQuery ) /* PRIVILEGED_FUNCTION */
@@ -2163,6 +2393,67 @@
     #endif /*#if ( configUSE_TASK_NOTIFICATIONS == 1 )*/
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+        BaseType_t MPU_xTaskNotifyMultipleFromISR( const TaskNotifyTarget_t * pxTargets,
+                                                   UBaseType_t uxNumberOfTargets,
+                                                   BaseType_t * pxHigherPriorityTaskWoken ) /* PRIVILEGED_FUNCTION */
+        {
+            TaskNotifyTarget_t xInternalTargets[ NOTIFY_MULTIPLE_BATCH_SIZE ];
+            BaseType_t xReturn = pdPASS;
+            UBaseType_t uxTarget;
+            UBaseType_t uxBatchLength = 0U;
+            int32_t lIndex;
+
+            if( ( pxTargets == NULL ) && ( uxNumberOfTargets != ( UBaseType_t ) 0U ) )
+            {
+                xReturn = pdFAIL;
+            }
+
+            /* Reject the whole call, before any notification is sent, if any
+             * target is not a valid task handle. */
+            for( uxTarget = 0U; ( uxTarget < uxNumberOfTargets ) && ( xReturn == pdPASS ); uxTarget++ )
+            {
+                lIndex = ( int32_t ) ( pxTargets[ uxTarget ].xTaskToNotify );
+
+                if( ( IS_EXTERNAL_INDEX_VALID( lIndex ) == pdFALSE ) ||
+                    ( MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) ) == NULL ) )
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+
+            if( xReturn == pdPASS )
+            {
+                /* Send the notifications in batches, each with the targets
+                 * translated to internal task handles.  The kernel only ever
+                 * sets *pxHigherPriorityTaskWoken to pdTRUE, so the batches
+                 * combine as a single call would. */
+                for( uxTarget = 0U; uxTarget < uxNumberOfTargets; uxTarget++ )
+                {
+                    xInternalTargets[ uxBatchLength ] = pxTargets[ uxTarget ];
+                    lIndex = ( int32_t ) ( pxTargets[ uxTarget ].xTaskToNotify );
+                    xInternalTargets[ uxBatchLength ].xTaskToNotify = MPU_GetTaskHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+                    uxBatchLength++;
+
+                    if( ( uxBatchLength == NOTIFY_MULTIPLE_BATCH_SIZE ) || ( uxTarget == ( uxNumberOfTargets - 1U ) ) )
+                    {
+                        if( xTaskNotifyMultipleFromISR( xInternalTargets, uxBatchLength, pxHigherPriorityTaskWoken ) != pdPASS )
+                        {
+                            xReturn = pdFAIL;
+                        }
+
+                        uxBatchLength = 0U;
+                    }
+                }
+            }
+
+            return xReturn;
+        }
+
+    #endif /* #if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+/*-----------------------------------------------------------*/
+
 /*-----------------------------------------------------------*/
 /*            MPU wrappers for queue APIs.                   */
 /*-----------------------------------------------------------*/
@@ -2927,6 +3218,39 @@
     #endif /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
+    #if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+        QueueHandle_t MPU_xQueueCreatePriority( UBaseType_t uxQueueLength,
+                                                UBaseType_t uxItemSize,
+                                                UBaseType_t uxNumberOfPriorities ) /* PRIVILEGED_FUNCTION */
+        {
+            QueueHandle_t xInternalQueueHandle = NULL;
+            QueueHandle_t xExternalQueueHandle = NULL;
+            int32_t lIndex;
+
+            lIndex = MPU_GetFreeIndexInKernelObjectPool();
+
+            if( lIndex != -1 )
+            {
+                xInternalQueueHandle = xQueueCreatePriority( uxQueueLength, uxItemSize, uxNumberOfPriorities );
+
+                if( xInternalQueueHandle != NULL )
+                {
+                    MPU_StoreQueueHandleAtIndex( lIndex, xInternalQueueHandle );
+                    xExternalQueueHandle = ( QueueHandle_t ) CONVERT_TO_EXTERNAL_INDEX( lIndex );
+                }
+                else
+                {
+                    MPU_SetIndexFreeInKernelObjectPool( lIndex );
+                }
+            }
+
+            return xExternalQueueHandle;
+        }
+
+    #endif /* if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
 
         QueueHandle_t MPU_xQueueGenericCreateStatic( const UBaseType_t uxQueueLength,
@@ -3349,6 +3673,54 @@
     #endif /* if ( configUSE_QUEUE_SETS == 1 ) */
 /*-----------------------------------------------------------*/
 
+    BaseType_t MPU_xQueuePeekInPlace( QueueHandle_t xQueue,
+                                      void ** const ppvItems,
+                                      UBaseType_t * const puxItemsAvailable,
+                                      TickType_t xTicksToWait ) /* PRIVILEGED_FUNCTION */
+    {
+        int32_t lIndex;
+        QueueHandle_t xInternalQueueHandle = NULL;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+
+        lIndex = ( int32_t ) xQueue;
+
+        if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+        {
+            xInternalQueueHandle = MPU_GetQueueHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+            if( xInternalQueueHandle != NULL )
+            {
+                xReturn = xQueuePeekInPlace( xInternalQueueHandle, ppvItems, puxItemsAvailable, xTicksToWait );
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t MPU_xQueueReleaseInPlace( QueueHandle_t xQueue,
+                                         UBaseType_t uxItemsToRelease ) /* PRIVILEGED_FUNCTION */
+    {
+        int32_t lIndex;
+        QueueHandle_t xInternalQueueHandle = NULL;
+        BaseType_t xReturn = pdFAIL;
+
+        lIndex = ( int32_t ) xQueue;
+
+        if( IS_EXTERNAL_INDEX_VALID( lIndex ) != pdFALSE )
+        {
+            xInternalQueueHandle = MPU_GetQueueHandleAtIndex( CONVERT_TO_INTERNAL_INDEX( lIndex ) );
+
+            if( xInternalQueueHandle != NULL )
+            {
+                xReturn = xQueueReleaseInPlace( xInternalQueueHandle, uxItemsToRelease );
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
 /*-----------------------------------------------------------*/
 /*            MPU wrappers for timers APIs.                  */
 /*-----------------------------------------------------------*/
@@ -4282,7 +4654,7 @@
     #endif /* #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EVENT_GROUPS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) || ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) ) )
 
         BaseType_t MPU_xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup,
                                                     const EventBits_t uxBitsToClear ) /* PRIVILEGED_FUNCTION */
@@ -4306,10 +4678,10 @@
             return xReturn;
         }
 
-    #endif /* #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) || ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) ) ) */
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) || ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) ) )
 
         BaseType_t MPU_xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                                   const EventBits_t uxBitsToSet,
@@ -4334,7 +4706,7 @@
             return xReturn;
         }
 
-    #endif /* #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* #if ( ( configUSE_EVENT_GROUPS == 1 ) && ( ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) || ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_64_BIT_EVENT_GROUPS == 1 ) ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) ) ) */
 /*-----------------------------------------------------------*/
 
     #if ( configUSE_EVENT_GROUPS == 1 )
@@ -119,7 +119,7 @@
 #define portDAIF_I                 ( 0x80 )
 
 /* Macro to unmask all interrupt priorities. */
-#define portCLEAR_INTERRUPT_MASK()                            \
+#define portUNMASK_ALL_INTERRUPT_PRIORITIES()                 \
     {                                                         \
         portDISABLE_INTERRUPTS();                             \
         portICCPMR_PRIORITY_MASK_REGISTER = portUNMASK_VALUE; \
@@ -137,6 +137,24 @@
  * There are 32 128-bit registers.*/
 #define portFPU_REGISTER_WORDS     ( 32 * 2 )
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* GIC distributor registers used to generate and enable the SGI that yields
+ * another core. */
+    #define portGICD_ISENABLER0_OFFSET    ( 0x100UL )
+    #define portGICD_SGIR_OFFSET          ( 0xF00UL )
+    #define portGICD_ISENABLER0_REGISTER  ( *( ( volatile uint32_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portGICD_ISENABLER0_OFFSET ) ) )
+    #define portGICD_SGIR_REGISTER        ( *( ( volatile uint32_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portGICD_SGIR_OFFSET ) ) )
+    #define portGICD_SGIR_TARGET_SHIFT    ( 16UL )
+
+/* The value held in a lock's owner when no core holds the lock. */
+    #define portLOCK_NO_OWNER             ( ( uint64_t ) -1 )
+
+    #if ( configYIELD_CORE_SGI_ID > 15 )
+        #error "configYIELD_CORE_SGI_ID must be an SGI, so between 0 and 15"
+    #endif
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -147,29 +165,67 @@ extern void vPortRestoreTaskContext( void );
 
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES == 1 )
+
 /* A variable is used to keep track of the critical section nesting.  This
  * variable has to be stored as part of the task context and must be initialised to
  * a non zero value to ensure interrupts don't inadvertently become unmasked before
  * the scheduler starts.  As it is stored as part of the task context it will
  * automatically be set to 0 when the first task is started. */
-volatile uint64_t ullCriticalNesting = 9999ULL;
+    volatile uint64_t ullCriticalNesting = 9999ULL;
 
 /* Saved as part of the task context.  If ullPortTaskHasFPUContext is non-zero
  * then floating point context must be saved and restored for the task. */
-uint64_t ullPortTaskHasFPUContext = pdFALSE;
+    uint64_t ullPortTaskHasFPUContext = pdFALSE;
 
 /* Set to 1 to pend a context switch from an ISR. */
-uint64_t ullPortYieldRequired = pdFALSE;
+    uint64_t ullPortYieldRequired = pdFALSE;
 
 /* Counts the interrupt nesting depth.  A context switch is only performed if
  * if the nesting depth is 0. */
-uint64_t ullPortInterruptNesting = 0;
+    uint64_t ullPortInterruptNesting = 0;
+
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+
+/* As above, but with one of each variable per core, indexed by core ID.  The
+ * kernel only switches context outside of critical sections in SMP FreeRTOS, so
+ * the critical nesting counts start at 0. */
+    volatile uint64_t ullCriticalNesting[ configNUMBER_OF_CORES ] = { 0ULL };
+    uint64_t ullPortTaskHasFPUContext[ configNUMBER_OF_CORES ] = { pdFALSE };
+    uint64_t ullPortYieldRequired[ configNUMBER_OF_CORES ] = { pdFALSE };
+    uint64_t ullPortInterruptNesting[ configNUMBER_OF_CORES ] = { 0ULL };
+
+/* A recursive spinlock.  Only the core that holds the lock writes its owner
+ * and recursion count. */
+    typedef struct PORT_RECURSIVE_LOCK
+    {
+        volatile uint32_t ulLock;     /* 0 when the lock is free, 1 when it is held. */
+        volatile uint64_t ullOwner;   /* The ID of the core holding the lock, or portLOCK_NO_OWNER. */
+        uint64_t ullRecursionCount;   /* The number of times the owner has acquired the lock without releasing it. */
+    } PortRecursiveLock_t;
+
+/* The kernel's task and ISR locks, indexed by portTASK_LOCK and
+ * portISR_LOCK. */
+    static PortRecursiveLock_t xPortLocks[ portMAX_CORE_LOCKS ] =
+    {
+        { 0U, portLOCK_NO_OWNER, 0ULL },
+        { 0U, portLOCK_NO_OWNER, 0ULL }
+    };
+
+/* Set by the primary core once the kernel is ready for the other cores to
+ * start their first task. */
+    static volatile uint64_t ullPortSchedulerStarted = pdFALSE;
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
 /* Used in the ASM code. */
 __attribute__( ( used ) ) const uint64_t ullICCEOIR = portICCEOIR_END_OF_INTERRUPT_REGISTER_ADDRESS;
 __attribute__( ( used ) ) const uint64_t ullICCIAR = portICCIAR_INTERRUPT_ACKNOWLEDGE_REGISTER_ADDRESS;
 __attribute__( ( used ) ) const uint64_t ullICCPMR = portICCPMR_PRIORITY_MASK_REGISTER_ADDRESS;
 __attribute__( ( used ) ) const uint64_t ullMaxAPIPriorityMask = ( configMAX_API_CALL_INTERRUPT_PRIORITY << portPRIORITY_SHIFT );
+#if ( configNUMBER_OF_CORES > 1 )
+    __attribute__( ( used ) ) const uint64_t ullYieldCoreSGIID = configYIELD_CORE_SGI_ID;
+#endif
 
 /*-----------------------------------------------------------*/
 
@@ -282,7 +338,12 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
         pxTopOfStack--;
         *pxTopOfStack = pdTRUE;
-        ullPortTaskHasFPUContext = pdTRUE;
+
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            ullPortTaskHasFPUContext = pdTRUE;
+        }
+        #endif
     }
     #else /* if ( configUSE_TASK_FPU_SUPPORT == 1 ) */
     {
@@ -363,8 +424,40 @@ BaseType_t xPortStartScheduler( void )
              * executing. */
             portDISABLE_INTERRUPTS();
 
-            /* Start the timer that generates the tick ISR. */
-            configSETUP_TICK_INTERRUPT();
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                /* Start the timer that generates the tick ISR. */
+                configSETUP_TICK_INTERRUPT();
+            }
+            #else
+            {
+                /* The SGI's priority and enable registers are banked, so each
+                 * core configures the yield SGI for itself. */
+                *( ( volatile uint8_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portINTERRUPT_PRIORITY_REGISTER_OFFSET + configYIELD_CORE_SGI_ID ) ) = ( uint8_t ) ( portLOWEST_USABLE_INTERRUPT_PRIORITY << portPRIORITY_SHIFT );
+                portGICD_ISENABLER0_REGISTER = ( 1UL << configYIELD_CORE_SGI_ID );
+
+                if( portGET_CORE_ID() == 0 )
+                {
+                    /* Only the primary core generates the tick.  The kernel
+                     * yields the other cores when the tick readies a task for
+                     * them. */
+                    configSETUP_TICK_INTERRUPT();
+
+                    /* vTaskStartScheduler() has selected a task for each core,
+                     * so release the other cores. */
+                    ullPortSchedulerStarted = pdTRUE;
+                    __asm volatile ( "DSB SY     \n"
+                                     "SEV        \n" ::: "memory" );
+                }
+                else
+                {
+                    while( ullPortSchedulerStarted == pdFALSE )
+                    {
+                        __asm volatile ( "WFE" ::: "memory" );
+                    }
+                }
+            }
+            #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
             /* Start the first task executing. */
             vPortRestoreTaskContext();
@@ -379,50 +472,58 @@ void vPortEndScheduler( void )
 {
     /* Not implemented in ports where there is nothing to return to.
      * Artificially force an assert. */
-    configASSERT( ullCriticalNesting == 1000ULL );
+    #if ( configNUMBER_OF_CORES == 1 )
+        configASSERT( ullCriticalNesting == 1000ULL );
+    #else
+        configASSERT( ullCriticalNesting[ portGET_CORE_ID() ] == 1000ULL );
+    #endif
 }
 /*-----------------------------------------------------------*/
 
-void vPortEnterCritical( void )
-{
-    /* Mask interrupts up to the max syscall interrupt priority. */
-    uxPortSetInterruptMask();
-
-    /* Now interrupts are disabled ullCriticalNesting can be accessed
-     * directly.  Increment ullCriticalNesting to keep a count of how many times
-     * portENTER_CRITICAL() has been called. */
-    ullCriticalNesting++;
-
-    /* This is not the interrupt safe version of the enter critical function so
-     * assert() if it is being called from an interrupt context.  Only API
-     * functions that end in "FromISR" can be used in an interrupt.  Only assert if
-     * the critical nesting count is 1 to protect against recursive calls if the
-     * assert function also uses a critical section. */
-    if( ullCriticalNesting == 1ULL )
+#if ( configNUMBER_OF_CORES == 1 )
+
+    void vPortEnterCritical( void )
     {
-        configASSERT( ullPortInterruptNesting == 0 );
+        /* Mask interrupts up to the max syscall interrupt priority. */
+        uxPortSetInterruptMask();
+
+        /* Now interrupts are disabled ullCriticalNesting can be accessed
+         * directly.  Increment ullCriticalNesting to keep a count of how many times
+         * portENTER_CRITICAL() has been called. */
+        ullCriticalNesting++;
+
+        /* This is not the interrupt safe version of the enter critical function so
+         * assert() if it is being called from an interrupt context.  Only API
+         * functions that end in "FromISR" can be used in an interrupt.  Only assert if
+         * the critical nesting count is 1 to protect against recursive calls if the
+         * assert function also uses a critical section. */
+        if( ullCriticalNesting == 1ULL )
+        {
+            configASSERT( ullPortInterruptNesting == 0 );
+        }
     }
-}
 /*-----------------------------------------------------------*/
 
-void vPortExitCritical( void )
-{
-    if( ullCriticalNesting > portNO_CRITICAL_NESTING )
+    void vPortExitCritical( void )
     {
-        /* Decrement the nesting count as the critical section is being
-         * exited. */
-        ullCriticalNesting--;
-
-        /* If the nesting level has reached zero then all interrupt
-         * priorities must be re-enabled. */
-        if( ullCriticalNesting == portNO_CRITICAL_NESTING )
+        if( ullCriticalNesting > portNO_CRITICAL_NESTING )
         {
-            /* Critical nesting has reached zero so all interrupt priorities
-             * should be unmasked. */
-            portCLEAR_INTERRUPT_MASK();
+            /* Decrement the nesting count as the critical section is being
+             * exited. */
+            ullCriticalNesting--;
+
+            /* If the nesting level has reached zero then all interrupt
+             * priorities must be re-enabled. */
+            if( ullCriticalNesting == portNO_CRITICAL_NESTING )
+            {
+                /* Critical nesting has reached zero so all interrupt priorities
+                 * should be unmasked. */
+                portUNMASK_ALL_INTERRUPT_PRIORITIES();
+            }
         }
     }
-}
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 /*-----------------------------------------------------------*/
 
 void FreeRTOS_Tick_Handler( void )
@@ -444,27 +545,50 @@ void FreeRTOS_Tick_Handler( void )
     }
     #endif /* configASSERT_DEFINED */
 
-    /* Set interrupt mask before altering scheduler structures.   The tick
-     * handler runs at the lowest priority, so interrupts cannot already be masked,
-     * so there is no need to save and restore the current mask value.  It is
-     * necessary to turn off interrupts in the CPU itself while the ICCPMR is being
-     * updated. */
-    portICCPMR_PRIORITY_MASK_REGISTER = ( uint32_t ) ( configMAX_API_CALL_INTERRUPT_PRIORITY << portPRIORITY_SHIFT );
-    __asm volatile ( "dsb sy     \n"
-                     "isb sy     \n" ::: "memory" );
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
+        /* Set interrupt mask before altering scheduler structures.   The tick
+         * handler runs at the lowest priority, so interrupts cannot already be masked,
+         * so there is no need to save and restore the current mask value.  It is
+         * necessary to turn off interrupts in the CPU itself while the ICCPMR is being
+         * updated. */
+        portICCPMR_PRIORITY_MASK_REGISTER = ( uint32_t ) ( configMAX_API_CALL_INTERRUPT_PRIORITY << portPRIORITY_SHIFT );
+        __asm volatile ( "dsb sy     \n"
+                         "isb sy     \n" ::: "memory" );
 
-    /* Ok to enable interrupts after the interrupt source has been cleared. */
-    configCLEAR_TICK_INTERRUPT();
-    portENABLE_INTERRUPTS();
+        /* Ok to enable interrupts after the interrupt source has been cleared. */
+        configCLEAR_TICK_INTERRUPT();
+        portENABLE_INTERRUPTS();
 
-    /* Increment the RTOS tick. */
-    if( xTaskIncrementTick() != pdFALSE )
+        /* Increment the RTOS tick. */
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            ullPortYieldRequired = pdTRUE;
+        }
+
+        /* Ensure all interrupt priorities are active again. */
+        portUNMASK_ALL_INTERRUPT_PRIORITIES();
+    }
+    #else /* if ( configNUMBER_OF_CORES == 1 ) */
     {
-        ullPortYieldRequired = pdTRUE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Clear the interrupt source before the interrupt safe critical
+         * section re-enables interrupts in the CPU.  The critical section
+         * masks interrupts up to configMAX_API_CALL_INTERRUPT_PRIORITY and
+         * holds the ISR lock while the scheduler structures are altered. */
+        configCLEAR_TICK_INTERRUPT();
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            /* Increment the RTOS tick. */
+            if( xTaskIncrementTick() != pdFALSE )
+            {
+                ullPortYieldRequired[ portGET_CORE_ID() ] = pdTRUE;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
     }
-
-    /* Ensure all interrupt priorities are active again. */
-    portCLEAR_INTERRUPT_MASK();
+    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 }
 /*-----------------------------------------------------------*/
 
@@ -474,7 +598,21 @@ void FreeRTOS_Tick_Handler( void )
     {
         /* A task is registering the fact that it needs an FPU context.  Set the
          * FPU flag (which is saved as part of the task context). */
-        ullPortTaskHasFPUContext = pdTRUE;
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            ullPortTaskHasFPUContext = pdTRUE;
+        }
+        #else
+        {
+            UBaseType_t uxDAIF;
+
+            /* Prevent the task moving to another core between reading the core
+             * ID and setting the flag. */
+            uxDAIF = uxPortDisableInterruptsSaveState();
+            ullPortTaskHasFPUContext[ portGET_CORE_ID() ] = pdTRUE;
+            vPortRestoreInterruptState( uxDAIF );
+        }
+        #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
         /* Consider initialising the FPSR here - but probably not necessary in
          * AArch64. */
@@ -487,7 +625,7 @@ void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
 {
     if( uxNewMaskValue == pdFALSE )
     {
-        portCLEAR_INTERRUPT_MASK();
+        portUNMASK_ALL_INTERRUPT_PRIORITIES();
     }
 }
 /*-----------------------------------------------------------*/
@@ -554,3 +692,87 @@ UBaseType_t uxPortSetInterruptMask( void )
 
 #endif /* configASSERT_DEFINED */
 /*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        /* Make the kernel's updates visible to the other core before it takes
+         * the interrupt. */
+        __asm volatile ( "DSB SY" ::: "memory" );
+
+        /* Send the yield SGI to the GIC CPU interface of the core. */
+        portGICD_SGIR_REGISTER = ( uint32_t ) ( ( 1UL << ( portGICD_SGIR_TARGET_SHIFT + ( uint32_t ) xCoreID ) ) | configYIELD_CORE_SGI_ID );
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortRecursiveLockAcquire( BaseType_t xCoreID,
+                                    BaseType_t xLockNum )
+    {
+        PortRecursiveLock_t * const pxLock = &( xPortLocks[ xLockNum ] );
+        uint32_t ulLockValue;
+        uint32_t ulStoreFailed;
+
+        configASSERT( xLockNum < portMAX_CORE_LOCKS );
+
+        if( pxLock->ullOwner == ( uint64_t ) xCoreID )
+        {
+            /* This core already holds the lock. */
+            ( pxLock->ullRecursionCount )++;
+        }
+        else
+        {
+            /* Wait in a low power state until the lock is released, which
+             * clears the exclusive monitor and so generates an event.  The
+             * load-acquire orders the accesses made while holding the lock
+             * after the lock is taken.  Exclusive accesses require the lock to
+             * be in normal, cacheable memory. */
+            __asm volatile (
+                "   SEVL                        \n"
+                "1: WFE                         \n"
+                "2: LDAXR   %w0, [%2]           \n"
+                "   CBNZ    %w0, 1b             \n"
+                "   STXR    %w1, %w3, [%2]      \n"
+                "   CBNZ    %w1, 2b             \n"
+                : "=&r" ( ulLockValue ), "=&r" ( ulStoreFailed )
+                : "r" ( &( pxLock->ulLock ) ), "r" ( 1U )
+                : "memory"
+                );
+
+            pxLock->ullOwner = ( uint64_t ) xCoreID;
+            pxLock->ullRecursionCount = 1ULL;
+        }
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortRecursiveLockRelease( BaseType_t xCoreID,
+                                    BaseType_t xLockNum )
+    {
+        PortRecursiveLock_t * const pxLock = &( xPortLocks[ xLockNum ] );
+
+        configASSERT( xLockNum < portMAX_CORE_LOCKS );
+        configASSERT( pxLock->ullOwner == ( uint64_t ) xCoreID );
+        configASSERT( pxLock->ullRecursionCount > 0ULL );
+
+        ( pxLock->ullRecursionCount )--;
+
+        if( pxLock->ullRecursionCount == 0ULL )
+        {
+            pxLock->ullOwner = portLOCK_NO_OWNER;
+
+            /* The store-release orders the accesses made while holding the
+             * lock before the lock is released. */
+            __asm volatile ( "STLR WZR, [%0]" :: "r" ( &( pxLock->ulLock ) ) : "memory" );
+        }
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
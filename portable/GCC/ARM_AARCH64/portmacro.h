@@ -78,15 +78,27 @@ typedef uint64_t         TickType_t;
 /* Task utilities. */
 
 /* Called at the end of an ISR that can cause a context switch. */
-#define portEND_SWITCHING_ISR( xSwitchRequired ) \
-    {                                            \
-        extern uint64_t ullPortYieldRequired;    \
-                                                 \
-        if( xSwitchRequired != pdFALSE )         \
-        {                                        \
-            ullPortYieldRequired = pdTRUE;       \
-        }                                        \
+#if ( configNUMBER_OF_CORES == 1 )
+    #define portEND_SWITCHING_ISR( xSwitchRequired ) \
+    {                                                \
+        extern uint64_t ullPortYieldRequired;        \
+                                                     \
+        if( xSwitchRequired != pdFALSE )             \
+        {                                            \
+            ullPortYieldRequired = pdTRUE;           \
+        }                                            \
     }
+#else
+    #define portEND_SWITCHING_ISR( xSwitchRequired )                       \
+    {                                                                      \
+        extern uint64_t ullPortYieldRequired[ configNUMBER_OF_CORES ];     \
+                                                                           \
+        if( xSwitchRequired != pdFALSE )                                   \
+        {                                                                  \
+            ullPortYieldRequired[ portGET_CORE_ID() ] = pdTRUE;            \
+        }                                                                  \
+    }
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
 #define portYIELD_FROM_ISR( x )    portEND_SWITCHING_ISR( x )
 #if defined( GUEST )
@@ -118,8 +130,10 @@ extern void vPortInstallFreeRTOSVectorTable( void );
 
 /* These macros do not globally disable/enable interrupts.  They do mask off
  * interrupts that have a priority below configMAX_API_CALL_INTERRUPT_PRIORITY. */
-#define portENTER_CRITICAL()                      vPortEnterCritical();
-#define portEXIT_CRITICAL()                       vPortExitCritical();
+#if ( configNUMBER_OF_CORES == 1 )
+    #define portENTER_CRITICAL()                  vPortEnterCritical();
+    #define portEXIT_CRITICAL()                   vPortExitCritical();
+#endif
 #define portSET_INTERRUPT_MASK_FROM_ISR()         uxPortSetInterruptMask()
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
 
@@ -152,9 +166,13 @@ void FreeRTOS_Tick_Handler( void );
 #define portLOWEST_INTERRUPT_PRIORITY           ( ( ( uint32_t ) configUNIQUE_INTERRUPT_PRIORITIES ) - 1UL )
 #define portLOWEST_USABLE_INTERRUPT_PRIORITY    ( portLOWEST_INTERRUPT_PRIORITY - 1UL )
 
-/* Architecture specific optimisations. */
+/* Architecture specific optimisations.  Not supported in SMP FreeRTOS. */
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
-    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #else
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+    #endif
 #endif
 
 #if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
@@ -215,6 +233,102 @@ void FreeRTOS_Tick_Handler( void );
 
 #define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
 
+/*-----------------------------------------------------------
+* SMP support
+*----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* The core ID is affinity level 0 of the MPIDR_EL1 register, so cores 0 to
+ * configNUMBER_OF_CORES - 1 must be in the same cluster.  The core ID is also
+ * used as the GIC CPU interface number when yielding another core. */
+    #define portMPIDR_CORE_ID_MASK    ( 0xFFULL )
+
+/* The SGI used to request a context switch on another core.  The port sets
+ * its priority and enables it on each core, and handles it before
+ * vApplicationIRQHandler() is called, so it must not be used by the
+ * application. */
+    #ifndef configYIELD_CORE_SGI_ID
+        #define configYIELD_CORE_SGI_ID    ( 0U )
+    #endif
+
+    #define portFORCE_INLINE    inline __attribute__( ( always_inline ) )
+
+    portFORCE_INLINE static BaseType_t xPortGetCoreID( void )
+    {
+        uint64_t ullMPIDR;
+
+        __asm volatile ( "MRS %0, MPIDR_EL1" : "=r" ( ullMPIDR ) );
+
+        return ( BaseType_t ) ( ullMPIDR & portMPIDR_CORE_ID_MASK );
+    }
+
+/* Disable IRQs in the CPU, returning the previous DAIF value. */
+    portFORCE_INLINE static UBaseType_t uxPortDisableInterruptsSaveState( void )
+    {
+        UBaseType_t uxDAIF;
+
+        __asm volatile ( "MRS %0, DAIF       \n"
+                         "MSR DAIFSET, #2    \n"
+                         "DSB SY             \n"
+                         "ISB SY             \n" : "=r" ( uxDAIF ) :: "memory" );
+
+        return uxDAIF;
+    }
+
+/* Restore the DAIF value returned by uxPortDisableInterruptsSaveState(). */
+    portFORCE_INLINE static void vPortRestoreInterruptState( UBaseType_t uxDAIF )
+    {
+        __asm volatile ( "MSR DAIF, %0       \n"
+                         "DSB SY             \n"
+                         "ISB SY             \n" :: "r" ( uxDAIF ) : "memory" );
+    }
+
+    extern volatile uint64_t ullCriticalNesting[ configNUMBER_OF_CORES ];
+    extern uint64_t ullPortInterruptNesting[ configNUMBER_OF_CORES ];
+
+    extern void vPortYieldCore( BaseType_t xCoreID );
+    extern void vPortRecursiveLockAcquire( BaseType_t xCoreID,
+                                           BaseType_t xLockNum );
+    extern void vPortRecursiveLockRelease( BaseType_t xCoreID,
+                                           BaseType_t xLockNum );
+
+/* The locks used by vPortRecursiveLockAcquire() and
+ * vPortRecursiveLockRelease(). */
+    #define portTASK_LOCK                                      ( 0 )
+    #define portISR_LOCK                                       ( 1 )
+    #define portMAX_CORE_LOCKS                                 ( 2 )
+
+    #define portGET_CORE_ID()                                  xPortGetCoreID()
+    #define portYIELD_CORE( xCoreID )                          vPortYieldCore( xCoreID )
+
+    #define portGET_TASK_LOCK( xCoreID )                       vPortRecursiveLockAcquire( ( xCoreID ), portTASK_LOCK )
+    #define portRELEASE_TASK_LOCK( xCoreID )                   vPortRecursiveLockRelease( ( xCoreID ), portTASK_LOCK )
+    #define portGET_ISR_LOCK( xCoreID )                        vPortRecursiveLockAcquire( ( xCoreID ), portISR_LOCK )
+    #define portRELEASE_ISR_LOCK( xCoreID )                    vPortRecursiveLockRelease( ( xCoreID ), portISR_LOCK )
+
+/* The kernel's critical sections disable IRQs in the CPU, while the
+ * interrupt safe critical sections mask interrupts using the GIC as in the
+ * single core port. */
+    #define portSET_INTERRUPT_MASK()                           uxPortDisableInterruptsSaveState()
+    #define portCLEAR_INTERRUPT_MASK( uxDAIF )                 vPortRestoreInterruptState( uxDAIF )
+
+    #define portENTER_CRITICAL()                               vTaskEnterCritical()
+    #define portEXIT_CRITICAL()                                vTaskExitCritical()
+    #define portENTER_CRITICAL_FROM_ISR()                      vTaskEnterCriticalFromISR()
+    #define portEXIT_CRITICAL_FROM_ISR( x )                    vTaskExitCriticalFromISR( x )
+
+    #define portCRITICAL_NESTING_IN_TCB                        0
+    #define portGET_CRITICAL_NESTING_COUNT( xCoreID )          ( ullCriticalNesting[ ( xCoreID ) ] )
+    #define portSET_CRITICAL_NESTING_COUNT( xCoreID, x )       ( ullCriticalNesting[ ( xCoreID ) ] = ( x ) )
+    #define portINCREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( ullCriticalNesting[ ( xCoreID ) ]++ )
+    #define portDECREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( ullCriticalNesting[ ( xCoreID ) ]-- )
+
+    #define portCHECK_IF_IN_ISR()                              ( ullPortInterruptNesting[ portGET_CORE_ID() ] != 0ULL )
+    #define portASSERT_IF_IN_ISR()                             configASSERT( portCHECK_IF_IN_ISR() == pdFALSE )
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -64,17 +64,32 @@
  * of the stack used by main.  Using the linker script method will repurpose the
  * stack that was used by main before the scheduler was started for use as the
  * interrupt stack after the scheduler has started. */
-#ifdef configISR_STACK_SIZE_WORDS
+#if ( configNUMBER_OF_CORES == 1 )
+    #ifdef configISR_STACK_SIZE_WORDS
 static __attribute__( ( aligned( 16 ) ) ) StackType_t xISRStack[ configISR_STACK_SIZE_WORDS ] = { 0 };
 const StackType_t xISRStackTop = ( StackType_t ) &( xISRStack[ configISR_STACK_SIZE_WORDS & ~portBYTE_ALIGNMENT_MASK ] );
+    #else
+        extern const uint32_t __freertos_irq_stack_top[];
+        const StackType_t xISRStackTop = ( StackType_t ) __freertos_irq_stack_top;
+    #endif
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+
+/* Each hart needs its own interrupt stack, so the linker script method cannot
+ * be used in SMP FreeRTOS.  Each hart sets its entry of xISRStackTop[] when it
+ * starts the scheduler. */
+    #ifndef configISR_STACK_SIZE_WORDS
+        #error "configISR_STACK_SIZE_WORDS must be defined when configNUMBER_OF_CORES is greater than 1."
+    #endif
+static __attribute__( ( aligned( 16 ) ) ) StackType_t xISRStack[ configNUMBER_OF_CORES ][ configISR_STACK_SIZE_WORDS ] = { { 0 } };
+StackType_t xISRStackTop[ configNUMBER_OF_CORES ] = { 0 };
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+#ifdef configISR_STACK_SIZE_WORDS
 
 /* Don't use 0xa5 as the stack fill bytes as that is used by the kernel for
  * the task stacks, and so will legitimately appear in many positions within
  * the ISR stack. */
     #define portISR_STACK_FILL_BYTE    0xee
-#else
-    extern const uint32_t __freertos_irq_stack_top[];
-    const StackType_t xISRStackTop = ( StackType_t ) __freertos_irq_stack_top;
 #endif
 
 /*
@@ -93,14 +108,60 @@ const size_t uxTimerIncrementsForOneTick = ( size_t ) ( ( configCPU_CLOCK_HZ ) /
 UBaseType_t const ullMachineTimerCompareRegisterBase = configMTIMECMP_BASE_ADDRESS;
 volatile uint64_t * pullMachineTimerCompareRegister = NULL;
 
+#if ( configNUMBER_OF_CORES == 1 )
+
 /* Holds the critical nesting value - deliberately non-zero at start up to
  * ensure interrupts are not accidentally enabled before the scheduler starts. */
-size_t xCriticalNesting = ( size_t ) 0xaaaaaaaa;
-size_t * pxCriticalNesting = &xCriticalNesting;
+    size_t xCriticalNesting = ( size_t ) 0xaaaaaaaa;
+    size_t * pxCriticalNesting = &xCriticalNesting;
+
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+
+/* As above, but with one critical nesting value per hart, indexed by hart ID.
+ * The kernel only uses the critical nesting values once the scheduler is
+ * running in SMP FreeRTOS, so they start at 0. */
+    size_t xCriticalNesting[ configNUMBER_OF_CORES ] = { 0 };
+
+/* The value held in a lock's owner when no hart holds the lock. */
+    #define portLOCK_NO_OWNER    ( ( UBaseType_t ) -1 )
+
+/* A recursive spinlock.  Only the hart that holds the lock writes its owner
+ * and recursion count. */
+    typedef struct PORT_RECURSIVE_LOCK
+    {
+        volatile uint32_t ulLock;       /* 0 when the lock is free, 1 when it is held. */
+        volatile UBaseType_t uxOwner;   /* The ID of the hart holding the lock, or portLOCK_NO_OWNER. */
+        UBaseType_t uxRecursionCount;   /* The number of times the owner has acquired the lock without releasing it. */
+    } PortRecursiveLock_t;
+
+/* The kernel's task and ISR locks, indexed by portTASK_LOCK and
+ * portISR_LOCK. */
+    static PortRecursiveLock_t xPortLocks[ portMAX_CORE_LOCKS ] =
+    {
+        { 0U, portLOCK_NO_OWNER, 0U },
+        { 0U, portLOCK_NO_OWNER, 0U }
+    };
+
+/* Set by hart 0 once the kernel is ready for the other harts to start their
+ * first task. */
+    static volatile UBaseType_t uxPortSchedulerStarted = pdFALSE;
+
+/* The MSIP register of each hart is a 32-bit word, starting at
+ * configMSIP_BASE_ADDRESS.  Used in the ASM code to clear a yield request. */
+    __attribute__( ( used ) ) const UBaseType_t uxMSIPBaseAddress = configMSIP_BASE_ADDRESS;
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
 /* Used to catch tasks that attempt to return from their implementing function. */
 size_t xTaskReturnAddress = ( size_t ) portTASK_RETURN_ADDRESS;
 
+#if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+
+/* The mintthresh value used inside critical sections.  Used in the ASM code to
+ * restore the threshold of the task being switched in. */
+    __attribute__( ( used ) ) const UBaseType_t uxMaxSyscallInterruptThreshold = configMAX_SYSCALL_INTERRUPT_PRIORITY;
+#endif
+
 /* Set configCHECK_FOR_STACK_OVERFLOW to 3 to add ISR stack checking to task
  * stack checking.  A problem in the ISR stack will trigger an assert, not call
  * the stack overflow hook function (because the stack overflow hook is specific
@@ -117,7 +178,11 @@ size_t xTaskReturnAddress = ( size_t ) portTASK_RETURN_ADDRESS;
         portISR_STACK_FILL_BYTE, portISR_STACK_FILL_BYTE, portISR_STACK_FILL_BYTE, portISR_STACK_FILL_BYTE
     }; \
 
-    #define portCHECK_ISR_STACK()    configASSERT( ( memcmp( ( void * ) xISRStack, ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) == 0 ) )
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define portCHECK_ISR_STACK()    configASSERT( ( memcmp( ( void * ) xISRStack, ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) == 0 ) )
+    #else
+        #define portCHECK_ISR_STACK()    configASSERT( ( memcmp( ( void * ) xISRStack[ portGET_CORE_ID() ], ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) == 0 ) )
+    #endif
 #else /* if defined( configISR_STACK_SIZE_WORDS ) && ( configCHECK_FOR_STACK_OVERFLOW > 2 ) */
     /* Define the function away. */
     #define portCHECK_ISR_STACK()
@@ -161,34 +226,101 @@ BaseType_t xPortStartScheduler( void )
 {
     extern void xPortStartFirstTask( void );
 
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        const BaseType_t xCoreID = portGET_CORE_ID();
+
+        configASSERT( xCoreID < configNUMBER_OF_CORES );
+
+        /* Each hart sets up, and checks, its own interrupt stack. */
+        xISRStackTop[ xCoreID ] = ( StackType_t ) &( xISRStack[ xCoreID ][ configISR_STACK_SIZE_WORDS & ~portBYTE_ALIGNMENT_MASK ] );
+    }
+    #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
     #if ( configASSERT_DEFINED == 1 )
     {
         /* Check alignment of the interrupt stack - which is the same as the
          * stack that was being used by main() prior to the scheduler being
          * started. */
-        configASSERT( ( xISRStackTop & portBYTE_ALIGNMENT_MASK ) == 0 );
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            configASSERT( ( xISRStackTop & portBYTE_ALIGNMENT_MASK ) == 0 );
+        }
+        #else
+        {
+            configASSERT( ( xISRStackTop[ portGET_CORE_ID() ] & portBYTE_ALIGNMENT_MASK ) == 0 );
+        }
+        #endif
 
         #ifdef configISR_STACK_SIZE_WORDS
         {
-            memset( ( void * ) xISRStack, portISR_STACK_FILL_BYTE, sizeof( xISRStack ) );
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                memset( ( void * ) xISRStack, portISR_STACK_FILL_BYTE, sizeof( xISRStack ) );
+            }
+            #else
+            {
+                memset( ( void * ) xISRStack[ portGET_CORE_ID() ], portISR_STACK_FILL_BYTE, sizeof( xISRStack[ 0 ] ) );
+            }
+            #endif
         }
         #endif /* configISR_STACK_SIZE_WORDS */
     }
     #endif /* configASSERT_DEFINED */
 
-    /* If there is a CLINT then it is ok to use the default implementation
-     * in this file, otherwise vPortSetupTimerInterrupt() must be implemented to
-     * configure whichever clock is to be used to generate the tick interrupt. */
-    vPortSetupTimerInterrupt();
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
+        /* If there is a CLINT then it is ok to use the default implementation
+         * in this file, otherwise vPortSetupTimerInterrupt() must be implemented to
+         * configure whichever clock is to be used to generate the tick interrupt. */
+        vPortSetupTimerInterrupt();
 
-    #if ( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) )
+        #if ( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) )
+        {
+            /* Enable mtime and external interrupts.  1<<7 for timer interrupt,
+             * 1<<11 for external interrupt.  _RB_ What happens here when mtime is
+             * not present as with pulpino? */
+            __asm volatile ( "csrs mie, %0" ::"r" ( 0x880 ) );
+        }
+        #endif /* ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) */
+    }
+    #else /* if ( configNUMBER_OF_CORES == 1 ) */
     {
-        /* Enable mtime and external interrupts.  1<<7 for timer interrupt,
-         * 1<<11 for external interrupt.  _RB_ What happens here when mtime is
-         * not present as with pulpino? */
-        __asm volatile ( "csrs mie, %0" ::"r" ( 0x880 ) );
+        /* Every hart takes the machine software interrupt that yields it, and
+         * external interrupts.  1<<3 for software interrupt, 1<<11 for external
+         * interrupt. */
+        __asm volatile ( "csrs mie, %0" ::"r" ( 0x808 ) );
+
+        if( portGET_CORE_ID() == 0 )
+        {
+            /* Only hart 0 generates the tick, using its own mtimecmp register.
+             * The kernel yields the other harts when the tick readies a task
+             * for them. */
+            vPortSetupTimerInterrupt();
+
+            #if ( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) )
+            {
+                /* 1<<7 for timer interrupt. */
+                __asm volatile ( "csrs mie, %0" ::"r" ( 0x80 ) );
+            }
+            #endif /* ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) */
+
+            /* vTaskStartScheduler() has selected a task for each hart, so
+             * release the other harts. */
+            __asm volatile ( "fence rw, rw" ::: "memory" );
+            uxPortSchedulerStarted = pdTRUE;
+        }
+        else
+        {
+            while( uxPortSchedulerStarted == pdFALSE )
+            {
+                portNOP();
+            }
+
+            __asm volatile ( "fence rw, rw" ::: "memory" );
+        }
     }
-    #endif /* ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) */
+    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
     xPortStartFirstTask();
 
@@ -206,3 +338,113 @@ void vPortEndScheduler( void )
     }
 }
 /*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    BaseType_t xPortIncrementTick( void )
+    {
+        BaseType_t xSwitchRequired;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Called from the tick interrupt on hart 0.  The interrupt safe
+         * critical section holds the ISR lock while the scheduler structures
+         * are altered. */
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            xSwitchRequired = xTaskIncrementTick();
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xSwitchRequired;
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        volatile uint32_t * const pulMSIP = ( volatile uint32_t * ) ( uxMSIPBaseAddress + ( ( UBaseType_t ) xCoreID * sizeof( uint32_t ) ) );
+
+        configASSERT( xCoreID < configNUMBER_OF_CORES );
+
+        /* Make the kernel's updates visible to the other hart before it takes
+         * the interrupt, then raise its machine software interrupt. */
+        __asm volatile ( "fence rw, o" ::: "memory" );
+        *pulMSIP = 1UL;
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortRecursiveLockAcquire( BaseType_t xCoreID,
+                                    BaseType_t xLockNum )
+    {
+        PortRecursiveLock_t * const pxLock = &( xPortLocks[ xLockNum ] );
+        uint32_t ulLockValue;
+
+        configASSERT( xLockNum < portMAX_CORE_LOCKS );
+
+        if( pxLock->uxOwner == ( UBaseType_t ) xCoreID )
+        {
+            /* This hart already holds the lock. */
+            ( pxLock->uxRecursionCount )++;
+        }
+        else
+        {
+            /* Spin reading the lock until it looks free, so the waiting hart
+             * does not keep taking the cache line away from the holder, then
+             * try to take it with an atomic swap.  The acquire ordering on the
+             * swap orders the accesses made while holding the lock after the
+             * lock is taken. */
+            for( ; ; )
+            {
+                while( pxLock->ulLock != 0U )
+                {
+                    portNOP();
+                }
+
+                __asm volatile ( "amoswap.w.aq %0, %2, %1" : "=r" ( ulLockValue ), "+A" ( pxLock->ulLock ) : "r" ( 1U ) : "memory" );
+
+                if( ulLockValue == 0U )
+                {
+                    break;
+                }
+            }
+
+            pxLock->uxOwner = ( UBaseType_t ) xCoreID;
+            pxLock->uxRecursionCount = 1U;
+        }
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortRecursiveLockRelease( BaseType_t xCoreID,
+                                    BaseType_t xLockNum )
+    {
+        PortRecursiveLock_t * const pxLock = &( xPortLocks[ xLockNum ] );
+
+        configASSERT( xLockNum < portMAX_CORE_LOCKS );
+        configASSERT( pxLock->uxOwner == ( UBaseType_t ) xCoreID );
+        configASSERT( pxLock->uxRecursionCount > 0U );
+
+        ( pxLock->uxRecursionCount )--;
+
+        if( pxLock->uxRecursionCount == 0U )
+        {
+            pxLock->uxOwner = portLOCK_NO_OWNER;
+
+            /* The release ordering on the swap orders the accesses made while
+             * holding the lock before the lock is released. */
+            __asm volatile ( "amoswap.w.rl zero, zero, %0" : "+A" ( pxLock->ulLock ) :: "memory" );
+        }
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
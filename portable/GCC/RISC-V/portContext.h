@@ -37,14 +37,26 @@
     #define configENABLE_VPU 0
 #endif
 
+#ifndef configENABLE_CLIC_INTERRUPT_THRESHOLD
+    #define configENABLE_CLIC_INTERRUPT_THRESHOLD 0
+#endif
+
+/* configNUMBER_OF_CORES must be passed to the assembler, in the same way as
+ * configENABLE_FPU, when SMP FreeRTOS is used. */
+#ifndef configNUMBER_OF_CORES
+    #define configNUMBER_OF_CORES 1
+#endif
+
 #if __riscv_xlen == 64
     #define portWORD_SIZE    8
+    #define portWORD_SHIFT   3
     #define store_x          sd
     #define load_x           ld
 #elif __riscv_xlen == 32
     #define store_x          sw
     #define load_x           lw
     #define portWORD_SIZE    4
+    #define portWORD_SHIFT   2
 #else
     #error Assembler did not define __riscv_xlen
 #endif
@@ -118,10 +130,109 @@
 #endif
 /*-----------------------------------------------------------*/
 
-.extern pxCurrentTCB
+#if ( configNUMBER_OF_CORES == 1 )
+    .extern pxCurrentTCB
+    .extern pxCriticalNesting
+#else
+    .extern pxCurrentTCBs
+#endif
 .extern xISRStackTop
 .extern xCriticalNesting
-.extern pxCriticalNesting
+#if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+    .extern uxMaxSyscallInterruptThreshold
+#endif
+/*-----------------------------------------------------------*/
+
+#if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+    #define portMINTTHRESH_CSR    0x347
+#endif
+
+/* Read mcause into a0.  In CLIC mode mcause also holds the previous privilege
+ * mode, interrupt enable and interrupt level, so only the interrupt bit and the
+ * exception code are kept.  t0 is overwritten. */
+   .macro portcontextREAD_MCAUSE
+csrr a0, mcause
+#if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+    srli t0, a0, __riscv_xlen - 1
+    slli t0, t0, __riscv_xlen - 1       /* t0 = interrupt bit. */
+    slli a0, a0, __riscv_xlen - 12
+    srli a0, a0, __riscv_xlen - 12      /* a0 = exception code. */
+    or a0, a0, t0
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Set mintthresh to match the critical nesting value in reg - masking
+ * interrupts up to configMAX_SYSCALL_INTERRUPT_PRIORITY if the task being
+ * restored is in a critical section.  reg is overwritten. */
+   .macro portcontextRESTORE_INTERRUPT_THRESHOLD reg
+#if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+    beqz \reg, 7f
+    load_x \reg, uxMaxSyscallInterruptThreshold
+7:
+    csrw portMINTTHRESH_CSR, \reg
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* Load the address of this hart's entry in the array of word sized values at
+ * symbol into reg.  temp is overwritten.  The hart ID is used as the index, so
+ * the harts must be numbered 0 to configNUMBER_OF_CORES - 1. */
+   .macro portcontextLOAD_HART_ENTRY_ADDRESS reg, temp, symbol
+csrr \temp, mhartid
+slli \temp, \temp, portWORD_SHIFT
+la \reg, \symbol
+add \reg, \reg, \temp
+   .endm
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+/* Load the current hart's pxCurrentTCB into reg.  temp is overwritten. */
+   .macro portcontextLOAD_CURRENT_TCB reg, temp
+#if ( configNUMBER_OF_CORES == 1 )
+load_x \reg, pxCurrentTCB
+#else
+portcontextLOAD_HART_ENTRY_ADDRESS \reg, \temp, pxCurrentTCBs
+load_x \reg, 0( \reg )
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Load the current hart's interrupt stack top into sp.  temp is overwritten. */
+   .macro portcontextSWITCH_TO_ISR_STACK temp
+#if ( configNUMBER_OF_CORES == 1 )
+load_x sp, xISRStackTop
+#else
+portcontextLOAD_HART_ENTRY_ADDRESS sp, \temp, xISRStackTop
+load_x sp, 0( sp )
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Load the current hart's critical nesting value into reg.  temp is
+ * overwritten. */
+   .macro portcontextLOAD_CRITICAL_NESTING reg, temp
+#if ( configNUMBER_OF_CORES == 1 )
+load_x \reg, xCriticalNesting
+#else
+portcontextLOAD_HART_ENTRY_ADDRESS \reg, \temp, xCriticalNesting
+load_x \reg, 0( \reg )
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Load the address of the current hart's critical nesting value into reg.
+ * temp is overwritten. */
+   .macro portcontextLOAD_CRITICAL_NESTING_ADDRESS reg, temp
+#if ( configNUMBER_OF_CORES == 1 )
+load_x \reg, pxCriticalNesting
+#else
+portcontextLOAD_HART_ENTRY_ADDRESS \reg, \temp, xCriticalNesting
+#endif
+   .endm
 /*-----------------------------------------------------------*/
 
     .macro portcontexSAVE_FPU_CONTEXT
@@ -303,7 +414,7 @@ store_x x15, 13 * portWORD_SIZE( sp )
     store_x x31, 29 * portWORD_SIZE( sp )
 #endif /* ifndef __riscv_32e */
 
-load_x t0, xCriticalNesting                                   /* Load the value of xCriticalNesting into t0. */
+portcontextLOAD_CRITICAL_NESTING t0, t1                       /* Load the value of xCriticalNesting into t0. */
 store_x t0, portCRITICAL_NESTING_OFFSET * portWORD_SIZE( sp ) /* Store the critical nesting value to the stack. */
 
 #if( configENABLE_FPU == 1 )
@@ -363,34 +474,34 @@ store_x t0, 1 * portWORD_SIZE( sp )
 4:
 #endif
 
-load_x t0, pxCurrentTCB          /* Load pxCurrentTCB. */
-store_x sp, 0 ( t0 )             /* Write sp to first TCB member. */
+portcontextLOAD_CURRENT_TCB t0, t1 /* Load pxCurrentTCB. */
+store_x sp, 0 ( t0 )               /* Write sp to first TCB member. */
 
    .endm
 /*-----------------------------------------------------------*/
 
    .macro portcontextSAVE_EXCEPTION_CONTEXT
 portcontextSAVE_CONTEXT_INTERNAL
-csrr a0, mcause
+portcontextREAD_MCAUSE
 csrr a1, mepc
 addi a1, a1, 4          /* Synchronous so update exception return address to the instruction after the instruction that generated the exception. */
 store_x a1, 0 ( sp )    /* Save updated exception return address. */
-load_x sp, xISRStackTop /* Switch to ISR stack. */
+portcontextSWITCH_TO_ISR_STACK t0 /* Switch to ISR stack. */
    .endm
 /*-----------------------------------------------------------*/
 
    .macro portcontextSAVE_INTERRUPT_CONTEXT
 portcontextSAVE_CONTEXT_INTERNAL
-csrr a0, mcause
+portcontextREAD_MCAUSE
 csrr a1, mepc
 store_x a1, 0 ( sp )    /* Asynchronous interrupt so save unmodified exception return address. */
-load_x sp, xISRStackTop /* Switch to ISR stack. */
+portcontextSWITCH_TO_ISR_STACK t0 /* Switch to ISR stack. */
    .endm
 /*-----------------------------------------------------------*/
 
    .macro portcontextRESTORE_CONTEXT
-load_x t1, pxCurrentTCB /* Load pxCurrentTCB. */
-load_x sp, 0 ( t1 )     /* Read sp from first TCB member. */
+portcontextLOAD_CURRENT_TCB t1, t0 /* Load pxCurrentTCB. */
+load_x sp, 0 ( t1 )                /* Read sp from first TCB member. */
 
 /* Load mepc with the address of the instruction in the task to run next. */
 load_x t0, 0 ( sp )
@@ -426,8 +537,9 @@ portasmRESTORE_ADDITIONAL_REGISTERS
 #endif /* ifdef portasmSTORE_FPU_CONTEXT */
 
 load_x t0, portCRITICAL_NESTING_OFFSET * portWORD_SIZE( sp ) /* Obtain xCriticalNesting value for this task from task's stack. */
-load_x t1, pxCriticalNesting                                 /* Load the address of xCriticalNesting into t1. */
+portcontextLOAD_CRITICAL_NESTING_ADDRESS t1, t2             /* Load the address of xCriticalNesting into t1. */
 store_x t0, 0 ( t1 )                                         /* Restore the critical nesting value for this task. */
+portcontextRESTORE_INTERRUPT_THRESHOLD t0                    /* Restore the interrupt threshold for this task. */
 
 load_x x1,  2  * portWORD_SIZE( sp )
 load_x x5,  3  * portWORD_SIZE( sp )
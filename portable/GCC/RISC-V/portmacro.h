@@ -90,51 +90,101 @@ typedef portUBASE_TYPE   TickType_t;
 /*-----------------------------------------------------------*/
 
 /* Scheduler utilities. */
-extern void vTaskSwitchContext( void );
 #define portYIELD()                __asm volatile ( "ecall" );
-#define portEND_SWITCHING_ISR( xSwitchRequired ) \
-    do                                           \
-    {                                            \
-        if( xSwitchRequired != pdFALSE )         \
-        {                                        \
-            traceISR_EXIT_TO_SCHEDULER();        \
-            vTaskSwitchContext();                \
-        }                                        \
-        else                                     \
-        {                                        \
-            traceISR_EXIT();                     \
-        }                                        \
+#if ( configNUMBER_OF_CORES == 1 )
+    extern void vTaskSwitchContext( void );
+    #define portEND_SWITCHING_ISR( xSwitchRequired ) \
+    do                                               \
+    {                                                \
+        if( xSwitchRequired != pdFALSE )             \
+        {                                            \
+            traceISR_EXIT_TO_SCHEDULER();            \
+            vTaskSwitchContext();                    \
+        }                                            \
+        else                                         \
+        {                                            \
+            traceISR_EXIT();                         \
+        }                                            \
     } while( 0 )
+#else
+    extern void vTaskSwitchContext( BaseType_t xCoreID );
+    #define portEND_SWITCHING_ISR( xSwitchRequired )   \
+    do                                                 \
+    {                                                  \
+        if( xSwitchRequired != pdFALSE )               \
+        {                                              \
+            traceISR_EXIT_TO_SCHEDULER();              \
+            vTaskSwitchContext( portGET_CORE_ID() );   \
+        }                                              \
+        else                                           \
+        {                                              \
+            traceISR_EXIT();                           \
+        }                                              \
+    } while( 0 )
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 #define portYIELD_FROM_ISR( x )    portEND_SWITCHING_ISR( x )
 /*-----------------------------------------------------------*/
 
 /* Critical section management. */
 #define portCRITICAL_NESTING_IN_TCB    0
 
-#define portDISABLE_INTERRUPTS()                                   __asm volatile ( "csrc mstatus, 8" )
-#define portENABLE_INTERRUPTS()                                    __asm volatile ( "csrs mstatus, 8" )
+/* Set configENABLE_CLIC_INTERRUPT_THRESHOLD to 1 on chips whose CLIC runs in
+ * CLIC mode to mask interrupts by level rather than through mstatus.MIE.
+ * Critical sections then set the mintthresh CSR to
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY, so interrupts with a higher level keep
+ * running, but must not call FreeRTOS API functions.  The tick, the machine
+ * software interrupt and any interrupt that calls a FreeRTOS API function must
+ * have a level no higher than configMAX_SYSCALL_INTERRUPT_PRIORITY.  As with
+ * configENABLE_FPU, the setting must also be passed to the assembler. */
+#ifndef configENABLE_CLIC_INTERRUPT_THRESHOLD
+    #define configENABLE_CLIC_INTERRUPT_THRESHOLD    0
+#endif
+
+#if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+    #ifndef configMAX_SYSCALL_INTERRUPT_PRIORITY
+        #error "configMAX_SYSCALL_INTERRUPT_PRIORITY must be defined to the highest CLIC interrupt level that can call FreeRTOS API functions when configENABLE_CLIC_INTERRUPT_THRESHOLD is 1."
+    #endif
 
-extern size_t xCriticalNesting;
-#define portENTER_CRITICAL()      \
-    {                             \
-        portDISABLE_INTERRUPTS(); \
-        xCriticalNesting++;       \
+    #if ( ( configMAX_SYSCALL_INTERRUPT_PRIORITY < 1 ) || ( configMAX_SYSCALL_INTERRUPT_PRIORITY > 255 ) )
+        #error "configMAX_SYSCALL_INTERRUPT_PRIORITY must be a CLIC interrupt level between 1 and 255."
+    #endif
+
+    #define portMINTTHRESH_CSR                                     "0x347"
+
+    #define portDISABLE_INTERRUPTS()                               __asm volatile ( "csrw " portMINTTHRESH_CSR ", %0" ::"r" ( configMAX_SYSCALL_INTERRUPT_PRIORITY ) : "memory" )
+    #define portENABLE_INTERRUPTS()                                __asm volatile ( "csrw " portMINTTHRESH_CSR ", zero" ::: "memory" )
+#else
+    #define portDISABLE_INTERRUPTS()                               __asm volatile ( "csrc mstatus, 8" )
+    #define portENABLE_INTERRUPTS()                                __asm volatile ( "csrs mstatus, 8" )
+#endif /* if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 ) */
+
+#if ( configNUMBER_OF_CORES == 1 )
+    extern size_t xCriticalNesting;
+    #define portENTER_CRITICAL()      \
+    {                                 \
+        portDISABLE_INTERRUPTS();     \
+        xCriticalNesting++;           \
     }
 
-#define portEXIT_CRITICAL()          \
-    {                                \
-        xCriticalNesting--;          \
-        if( xCriticalNesting == 0 )  \
-        {                            \
-            portENABLE_INTERRUPTS(); \
-        }                            \
+    #define portEXIT_CRITICAL()          \
+    {                                    \
+        xCriticalNesting--;              \
+        if( xCriticalNesting == 0 )      \
+        {                                \
+            portENABLE_INTERRUPTS();     \
+        }                                \
     }
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
 /*-----------------------------------------------------------*/
 
-/* Architecture specific optimisations. */
+/* Architecture specific optimisations.  Not supported in SMP FreeRTOS. */
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
-    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+    #else
+        #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+    #endif
 #endif
 
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
@@ -197,6 +247,117 @@ extern size_t xCriticalNesting;
     #error "configMTIME_BASE_ADDRESS and configMTIMECMP_BASE_ADDRESS must be defined in FreeRTOSConfig.h.  Set them to zero if there is no MTIME (machine time) clock.  See www.FreeRTOS.org/Using-FreeRTOS-on-RISC-V.html"
 #endif /* if defined( configCLINT_BASE_ADDRESS ) && !defined( configMTIME_BASE_ADDRESS ) && ( configCLINT_BASE_ADDRESS == 0 ) */
 
+/*-----------------------------------------------------------
+* SMP support
+*----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    #ifndef __riscv_atomic
+        #error "configNUMBER_OF_CORES can only be set above 1 on RISC-V chips that implement the A (atomic) extension."
+    #endif
+
+/* The kernel yields another hart by raising its machine software interrupt,
+ * so the base address of the per-hart MSIP registers is needed.  That is the
+ * base address of a SiFive compatible CLINT, or of the MSWI device of an
+ * ACLINT. */
+    #if !defined( configMSIP_BASE_ADDRESS ) && defined( configCLINT_BASE_ADDRESS ) && ( configCLINT_BASE_ADDRESS != 0 )
+        #define configMSIP_BASE_ADDRESS    ( configCLINT_BASE_ADDRESS )
+    #elif !defined( configMSIP_BASE_ADDRESS )
+        #error "configMSIP_BASE_ADDRESS must be defined in FreeRTOSConfig.h when configNUMBER_OF_CORES is greater than 1.  Set it to the base address of the CLINT, or of the ACLINT MSWI device."
+    #endif
+
+/* The core ID is the hart ID, so the harts that run FreeRTOS must be numbered
+ * 0 to configNUMBER_OF_CORES - 1. */
+    portFORCE_INLINE static BaseType_t xPortGetCoreID( void )
+    {
+        UBaseType_t uxHartID;
+
+        __asm volatile ( "csrr %0, mhartid" : "=r" ( uxHartID ) );
+
+        return ( BaseType_t ) uxHartID;
+    }
+
+    #if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 )
+
+/* Raise mintthresh to configMAX_SYSCALL_INTERRUPT_PRIORITY, returning the
+ * previous threshold. */
+        portFORCE_INLINE static UBaseType_t uxPortDisableInterruptsSaveState( void )
+        {
+            UBaseType_t uxThreshold;
+
+            __asm volatile ( "csrrw %0, " portMINTTHRESH_CSR ", %1" : "=r" ( uxThreshold ) : "r" ( configMAX_SYSCALL_INTERRUPT_PRIORITY ) : "memory" );
+
+            return uxThreshold;
+        }
+
+/* Restore the threshold returned by uxPortDisableInterruptsSaveState(). */
+        portFORCE_INLINE static void vPortRestoreInterruptState( UBaseType_t uxThreshold )
+        {
+            __asm volatile ( "csrw " portMINTTHRESH_CSR ", %0" :: "r" ( uxThreshold ) : "memory" );
+        }
+
+    #else /* if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 ) */
+
+/* Clear mstatus.MIE, returning the previous mstatus value. */
+        portFORCE_INLINE static UBaseType_t uxPortDisableInterruptsSaveState( void )
+        {
+            UBaseType_t uxMStatus;
+
+            __asm volatile ( "csrrci %0, mstatus, 8" : "=r" ( uxMStatus ) :: "memory" );
+
+            return uxMStatus;
+        }
+
+/* Restore the mstatus.MIE value returned by
+ * uxPortDisableInterruptsSaveState(). */
+        portFORCE_INLINE static void vPortRestoreInterruptState( UBaseType_t uxMStatus )
+        {
+            __asm volatile ( "csrs mstatus, %0" :: "r" ( uxMStatus & ( UBaseType_t ) 8 ) : "memory" );
+        }
+
+    #endif /* if ( configENABLE_CLIC_INTERRUPT_THRESHOLD == 1 ) */
+
+    extern size_t xCriticalNesting[ configNUMBER_OF_CORES ];
+
+    extern void vPortYieldCore( BaseType_t xCoreID );
+    extern void vPortRecursiveLockAcquire( BaseType_t xCoreID,
+                                           BaseType_t xLockNum );
+    extern void vPortRecursiveLockRelease( BaseType_t xCoreID,
+                                           BaseType_t xLockNum );
+
+/* The locks used by vPortRecursiveLockAcquire() and
+ * vPortRecursiveLockRelease(). */
+    #define portTASK_LOCK                                      ( 0 )
+    #define portISR_LOCK                                       ( 1 )
+    #define portMAX_CORE_LOCKS                                 ( 2 )
+
+    #define portGET_CORE_ID()                                  xPortGetCoreID()
+    #define portYIELD_CORE( xCoreID )                          vPortYieldCore( xCoreID )
+
+    #define portGET_TASK_LOCK( xCoreID )                       vPortRecursiveLockAcquire( ( xCoreID ), portTASK_LOCK )
+    #define portRELEASE_TASK_LOCK( xCoreID )                   vPortRecursiveLockRelease( ( xCoreID ), portTASK_LOCK )
+    #define portGET_ISR_LOCK( xCoreID )                        vPortRecursiveLockAcquire( ( xCoreID ), portISR_LOCK )
+    #define portRELEASE_ISR_LOCK( xCoreID )                    vPortRecursiveLockRelease( ( xCoreID ), portISR_LOCK )
+
+/* Interrupts do not nest in this port, so the kernel's critical sections
+ * mask interrupts in the hart and the interrupt safe critical sections only
+ * need the ISR lock. */
+    #define portSET_INTERRUPT_MASK()                           uxPortDisableInterruptsSaveState()
+    #define portCLEAR_INTERRUPT_MASK( uxMStatus )              vPortRestoreInterruptState( uxMStatus )
+
+    #define portENTER_CRITICAL()                               vTaskEnterCritical()
+    #define portEXIT_CRITICAL()                                vTaskExitCritical()
+    #define portENTER_CRITICAL_FROM_ISR()                      vTaskEnterCriticalFromISR()
+    #define portEXIT_CRITICAL_FROM_ISR( x )                    vTaskExitCriticalFromISR( x )
+
+    #define portGET_CRITICAL_NESTING_COUNT( xCoreID )          ( xCriticalNesting[ ( xCoreID ) ] )
+    #define portSET_CRITICAL_NESTING_COUNT( xCoreID, x )       ( xCriticalNesting[ ( xCoreID ) ] = ( x ) )
+    #define portINCREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( xCriticalNesting[ ( xCoreID ) ]++ )
+    #define portDECREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( xCriticalNesting[ ( xCoreID ) ]-- )
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -50,6 +50,10 @@
     #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) )
+    #error configKERNEL_SNAPSHOT_INCLUDE_HEAP is only supported by heap_4.c and heap_5.c
+#endif
+
 /* A few bytes might be lost to byte aligning the heap start address. */
 #define configADJUSTED_HEAP_SIZE        ( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT )
 
@@ -52,6 +52,10 @@
     #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) )
+    #error configKERNEL_SNAPSHOT_INCLUDE_HEAP is only supported by heap_4.c and heap_5.c
+#endif
+
 #ifndef configHEAP_CLEAR_MEMORY_ON_FREE
     #define configHEAP_CLEAR_MEMORY_ON_FREE    0
 #endif
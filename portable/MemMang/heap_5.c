@@ -727,6 +727,44 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 }
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) )
+
+void vPortWriteHeapSnapshot( SnapshotWriter_t * pxWriter )
+{
+    /* This may be called from a fault handler, so the scheduler is not
+     * suspended. */
+    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &xStart, sizeof( xStart ) );
+    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &pxEnd, sizeof( pxEnd ) );
+    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &xFreeBytesRemaining, sizeof( xFreeBytesRemaining ) );
+    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &xMinimumEverFreeBytesRemaining, sizeof( xMinimumEverFreeBytesRemaining ) );
+    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &xNumberOfSuccessfulAllocations, sizeof( xNumberOfSuccessfulAllocations ) );
+    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &xNumberOfSuccessfulFrees, sizeof( xNumberOfSuccessfulFrees ) );
+
+    #if ( configENABLE_HEAP_PROTECTOR == 1 )
+    {
+        /* Needed to decode the block pointers. */
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, &xHeapCanary, sizeof( xHeapCanary ) );
+    }
+    #endif
+
+    /* pxEnd is NULL if the heap has not been initialised.  The free list is
+     * ordered by address and ends at pxEnd.  heapPROTECT_BLOCK_POINTER( NULL )
+     * is the mask applied to the block pointers, or 0 if they are not
+     * protected. */
+    if( pxEnd != NULL )
+    {
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, pxEnd, sizeof( BlockLink_t ) );
+        vTaskSnapshotWriteFreeBlocks( pxWriter,
+                                      heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock ),
+                                      pxEnd,
+                                      sizeof( BlockLink_t ),
+                                      ( portPOINTER_SIZE_TYPE ) heapPROTECT_BLOCK_POINTER( NULL ) );
+    }
+}
+
+#endif /* if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 /*
  * Reset the state in this file. This state is normally initialized at start up.
  * This function must be called by the application before restarting the
@@ -40,6 +40,12 @@
 * The timer interrupt uses SIGALRM and care is taken to ensure that
 * the signal handler runs only on the thread for the current task.
 *
+* Simulated peripheral interrupts use SIG_INTERRUPT.  Its handler services
+* the highest priority pending interrupt that is not masked, and lets a
+* higher priority interrupt nest while a handler runs.  Critical sections
+* leave SIG_INTERRUPT unblocked and mask interrupts at or below
+* configMAX_SYSCALL_INTERRUPT_PRIORITY in software instead.
+*
 * Use of part of the standard C library requires care as some
 * functions can take pthread mutexes internally which can result in
 * deadlocks as the FreeRTOS kernel can switch tasks while they're
@@ -49,6 +55,13 @@
 * only or serialized with a FreeRTOS primitive such as a binary
 * semaphore or mutex.
 *
+* xPortRecordSchedule() and xPortReplaySchedule() make the tick arrive
+* at the same points in each run, so an interleaving that was recorded
+* once can be replayed.  xPortExploreSchedule() instead injects ticks and
+* preemptions at those points from a seeded random sequence, so each seed
+* runs a different, repeatable interleaving.  Time only advances otherwise
+* while the idle task runs.  See portmacro.h.
+*
 * Note: When using LLDB (the default debugger on macOS) with this port,
 * suppress SIGUSR1 to prevent debugger interference. This can be
 * done by adding the following line to ~/.lldbinit:
@@ -59,6 +72,8 @@
 #endif
 #include "portmacro.h"
 #include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <pthread.h>
 #include <limits.h>
 #include <signal.h>
@@ -77,7 +92,40 @@
 #include "utils/wait_for_event.h"
 /*-----------------------------------------------------------*/
 
-#define SIG_RESUME    SIGUSR1
+#define SIG_RESUME       SIGUSR1
+#define SIG_INTERRUPT    SIGUSR2
+
+/* The number of simulated interrupt lines, one per bit of an uint32_t. */
+#define portMAX_INTERRUPTS    ( ( uint32_t ) sizeof( uint32_t ) * 8UL )
+
+/* Simulated interrupt priorities are 1 (lowest) to 255 (highest), and an
+ * interrupt above configMAX_SYSCALL_INTERRUPT_PRIORITY is not masked by
+ * critical sections.  By default, or when configMAX_SYSCALL_INTERRUPT_PRIORITY
+ * is 0 as in configurations written for other ports, every priority is
+ * masked. */
+#ifndef configMAX_SYSCALL_INTERRUPT_PRIORITY
+    #define configMAX_SYSCALL_INTERRUPT_PRIORITY    255
+#endif
+
+#if ( ( configMAX_SYSCALL_INTERRUPT_PRIORITY < 0 ) || ( configMAX_SYSCALL_INTERRUPT_PRIORITY > 255 ) )
+    #error configMAX_SYSCALL_INTERRUPT_PRIORITY must be between 0 and 255 in the POSIX port.
+#endif
+
+#if ( configMAX_SYSCALL_INTERRUPT_PRIORITY == 0 )
+    #define portMAX_MASKED_INTERRUPT_PRIORITY    ( ( UBaseType_t ) 255 )
+#else
+    #define portMAX_MASKED_INTERRUPT_PRIORITY    ( ( UBaseType_t ) configMAX_SYSCALL_INTERRUPT_PRIORITY )
+#endif
+
+/* The kinds of record in a schedule log. */
+#define portSCHEDULE_RECORD_TICK          'T' /* A tick taken at a schedule point. */
+#define portSCHEDULE_RECORD_ASYNC_TICK    'A' /* A tick taken by the SIGALRM handler between schedule points. */
+#define portSCHEDULE_RECORD_SWITCH        'S' /* The task selected by vTaskSwitchContext(). */
+#define portSCHEDULE_RECORD_INTERRUPT     'I' /* A simulated interrupt handler run. */
+
+/* How often the timer tick thread checks whether a replayed or explored tick
+ * is due. */
+#define portSCHEDULE_POLL_MICROSECONDS    10
 
 typedef struct THREAD
 {
@@ -86,8 +134,25 @@ typedef struct THREAD
     void * pvParams;
     BaseType_t xDying;
     struct event * ev;
+    UBaseType_t uxThreadNumber; /* Identifies the task in a schedule log. */
 } Thread_t;
 
+typedef enum
+{
+    eScheduleLogOff = 0, /* Ticks are delivered by SIGALRM as soon as they are raised. */
+    eScheduleLogRecord,  /* Ticks are taken at schedule points and logged. */
+    eScheduleLogReplay,  /* Ticks are taken where the log says they were taken. */
+    eScheduleLogExplore  /* Ticks and preemptions are injected at random schedule points. */
+} eScheduleLogMode;
+
+typedef struct SCHEDULE_RECORD
+{
+    char cKind;           /* One of the portSCHEDULE_RECORD_ values. */
+    uint64_t ullPoint;    /* The number of schedule points passed before the record. */
+    uint64_t ullThread;   /* The thread number selected, for portSCHEDULE_RECORD_SWITCH, or interrupted, for portSCHEDULE_RECORD_INTERRUPT. */
+    uint32_t ulInterrupt; /* The interrupt number, for portSCHEDULE_RECORD_INTERRUPT. */
+} ScheduleRecord_t;
+
 /*
  * The additional per-thread data is stored at the beginning of the
  * task's stack.
@@ -112,6 +177,41 @@ static pthread_t hTimerTickThread;
 static bool xTimerTickThreadShouldRun;
 static uint64_t prvStartTimeNs;
 static pthread_key_t xThreadKey = 0;
+static UBaseType_t uxNextThreadNumber = 0;
+
+/* Simulated interrupt controller state.  uxCurrentInterruptPriority is the
+ * priority of the handler that is running, or 0 in a task.
+ * uxInterruptMaskPriority is raised by portSET_INTERRUPT_MASK_FROM_ISR(), and
+ * xInterruptsMasked is set while a task has interrupts disabled. */
+static sigset_t xMaskableSignals;
+static sigset_t xInterruptSignal;
+static uint32_t ( * ulIsrHandler[ portMAX_INTERRUPTS ] )( void ) = { 0 };
+static uint8_t ucInterruptPriority[ portMAX_INTERRUPTS ];
+static uint64_t ullInterruptsRaised[ portMAX_INTERRUPTS ];
+static uint64_t ullInterruptsHandled[ portMAX_INTERRUPTS ];
+static uint32_t ulPendingInterrupts = 0;
+static volatile UBaseType_t uxCurrentInterruptPriority = 0;
+static volatile UBaseType_t uxInterruptMaskPriority = 0;
+static volatile BaseType_t xInterruptsMasked = pdTRUE;
+static volatile BaseType_t xInterruptYieldPending = pdFALSE;
+
+/* Schedule record/replay state.  A schedule point is passed each time a task
+ * disables or enables interrupts, so the schedule points are passed in the same
+ * order in each run that has the same interleaving. */
+static volatile eScheduleLogMode eScheduleMode = eScheduleLogOff;
+static int iScheduleLogFile = -1;
+static uint64_t ullSchedulePoints = 0;
+static uint32_t ulPendingTicks = 0;
+static ScheduleRecord_t * pxReplayRecords = NULL;
+static size_t xReplayRecordCount = 0;
+static size_t xNextReplayRecord = 0;
+static size_t xWaitingReplayRecord = 0;
+static uint32_t ulReplayRecordWaitPolls = 0;
+static BaseType_t xReplayComplete = pdFALSE;
+static uint32_t ulExploreSeed = 0;
+static uint32_t ulExploreState = 0;
+static uint32_t ulExploreOneIn = 0;
+static struct sigaction xExploreOriginalAbortAction;
 /*-----------------------------------------------------------*/
 
 static void prvSetupSignalsAndSchedulerPolicy( void );
@@ -122,6 +222,12 @@ static void prvSwitchThread( Thread_t * xThreadToResume,
 static void prvSuspendSelf( Thread_t * thread );
 static void prvResumeThread( Thread_t * xThreadId );
 static void vPortSystemTickHandler( int sig );
+static void prvInterruptDispatcher( int sig );
+static uint32_t prvHighestPendingInterrupt( void );
+static UBaseType_t prvInterruptMaskPriority( void );
+static void prvRunInterruptHandler( uint32_t ulInterruptNumber );
+static void prvYieldFromInterrupt( void );
+static void prvPendInterruptSignal( void );
 static void vPortStartFirstTask( void );
 static void prvPortYieldFromISR( void );
 static void prvThreadKeyDestructor( void * pvData );
@@ -129,6 +235,21 @@ static void prvInitThreadKey( void );
 static void prvMarkAsFreeRTOSThread( void );
 static BaseType_t prvIsFreeRTOSThread( void );
 static void prvDestroyThreadKey( void );
+static void prvProcessTick( void );
+static void prvSchedulePoint( void );
+static void prvTakeScheduledTicks( BaseType_t xAtSchedulePoint );
+static void prvScheduleLogSwitch( const Thread_t * pxThread );
+static void prvScheduleLogWrite( char cKind,
+                                 uint64_t ullThread,
+                                 uint32_t ulInterruptNumber );
+static const ScheduleRecord_t * prvNextReplayRecord( void );
+static BaseType_t prvReplayInterrupts( UBaseType_t uxMaskPriority );
+static void prvConsumeReplayRecord( void );
+static void prvReplayDiverged( const char * pcReason ) __attribute__( ( __noreturn__ ) );
+static void prvExploreSchedulePoint( void );
+static BaseType_t prvExploreIdleTaskRunning( void );
+static uint32_t prvExploreRandom( void );
+static void prvExploreAbortHandler( int sig );
 /*-----------------------------------------------------------*/
 
 static void prvThreadKeyDestructor( void * pvData )
@@ -231,6 +352,7 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
     thread->pxCode = pxCode;
     thread->pvParams = pvParameters;
     thread->xDying = pdFALSE;
+    thread->uxThreadNumber = uxNextThreadNumber++;
 
     pthread_attr_init( &xThreadAttributes );
 
@@ -315,6 +437,24 @@ BaseType_t xPortStartScheduler( void )
     /* Restore original signal mask. */
     ( void ) pthread_sigmask( SIG_SETMASK, &xSchedulerOriginalSignalMask, NULL );
 
+    /* A recording, replay or exploration only covers one run of the
+     * scheduler. */
+    if( eScheduleMode == eScheduleLogExplore )
+    {
+        ( void ) sigaction( SIGABRT, &xExploreOriginalAbortAction, NULL );
+    }
+
+    eScheduleMode = eScheduleLogOff;
+
+    if( iScheduleLogFile != -1 )
+    {
+        ( void ) close( iScheduleLogFile );
+        iScheduleLogFile = -1;
+    }
+
+    free( pxReplayRecords );
+    pxReplayRecords = NULL;
+
     prvDestroyThreadKey();
 
     return 0;
@@ -384,6 +524,8 @@ static void prvPortYieldFromISR( void )
 
     xThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
+    prvScheduleLogSwitch( xThreadToResume );
+
     prvSwitchThread( xThreadToResume, xThreadToSuspend );
 }
 /*-----------------------------------------------------------*/
@@ -406,7 +548,22 @@ void vPortDisableInterrupts( void )
 {
     if( prvIsFreeRTOSThread() == pdTRUE )
     {
-        pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+        /* Simulated interrupts above configMAX_SYSCALL_INTERRUPT_PRIORITY
+         * still run, so SIG_INTERRUPT is left unblocked and the others are
+         * masked by xInterruptsMasked. */
+        xInterruptsMasked = pdTRUE;
+
+        /* Ticks are only taken outside of critical sections. */
+        if( ( eScheduleMode != eScheduleLogOff ) && ( uxCriticalNesting == 0 ) )
+        {
+            pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+            prvSchedulePoint();
+            pthread_sigmask( SIG_UNBLOCK, &xInterruptSignal, NULL );
+        }
+        else
+        {
+            pthread_sigmask( SIG_BLOCK, &xMaskableSignals, NULL );
+        }
     }
 }
 /*-----------------------------------------------------------*/
@@ -415,22 +572,128 @@ void vPortEnableInterrupts( void )
 {
     if( prvIsFreeRTOSThread() == pdTRUE )
     {
+        if( ( eScheduleMode != eScheduleLogOff ) && ( uxCriticalNesting == 0 ) )
+        {
+            pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+            prvSchedulePoint();
+        }
+
         pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+        xInterruptsMasked = pdFALSE;
+
+        /* Take any interrupt that was masked, or that was raised while
+         * another task's thread was the target. */
+        prvPendInterruptSignal();
     }
 }
 /*-----------------------------------------------------------*/
 
 UBaseType_t xPortSetInterruptMask( void )
 {
-    /* Interrupts are always disabled inside ISRs (signals
-     * handlers). */
-    return ( UBaseType_t ) 0;
+    UBaseType_t uxSavedMaskPriority = uxInterruptMaskPriority;
+
+    /* Signal handlers run with the tick blocked, so only simulated
+     * interrupts that could nest need to be masked. */
+    if( uxSavedMaskPriority < portMAX_MASKED_INTERRUPT_PRIORITY )
+    {
+        uxInterruptMaskPriority = portMAX_MASKED_INTERRUPT_PRIORITY;
+    }
+
+    return uxSavedMaskPriority;
 }
 /*-----------------------------------------------------------*/
 
 void vPortClearInterruptMask( UBaseType_t uxMask )
 {
-    ( void ) uxMask;
+    uxInterruptMaskPriority = uxMask;
+
+    prvPendInterruptSignal();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configASSERT_DEFINED == 1 )
+
+    void vPortValidateInterruptPriority( void )
+    {
+        /* A simulated interrupt above configMAX_SYSCALL_INTERRUPT_PRIORITY
+         * is not masked by critical sections, so must not call the kernel. */
+        configASSERT( uxCurrentInterruptPriority <= portMAX_MASKED_INTERRUPT_PRIORITY );
+    }
+
+#endif /* configASSERT_DEFINED */
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber,
+                               uint32_t ( * pvHandler )( void ) )
+{
+    configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+    if( ulInterruptNumber < portMAX_INTERRUPTS )
+    {
+        if( ucInterruptPriority[ ulInterruptNumber ] == 0U )
+        {
+            ucInterruptPriority[ ulInterruptNumber ] = 1U;
+        }
+
+        ulIsrHandler[ ulInterruptNumber ] = pvHandler;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptPriority( uint32_t ulInterruptNumber,
+                                uint32_t ulPriority )
+{
+    configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+    configASSERT( ( ulPriority >= 1U ) && ( ulPriority <= 255U ) );
+
+    if( ulInterruptNumber < portMAX_INTERRUPTS )
+    {
+        ucInterruptPriority[ ulInterruptNumber ] = ( uint8_t ) ulPriority;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+    TaskHandle_t xRunningTask;
+
+    configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+    if( ulInterruptNumber < portMAX_INTERRUPTS )
+    {
+        ( void ) __atomic_add_fetch( &( ullInterruptsRaised[ ulInterruptNumber ] ), 1U, __ATOMIC_RELAXED );
+
+        /* While replaying, the handler runs where the log says it ran
+         * instead, so the interrupt is not pended. */
+        if( eScheduleMode != eScheduleLogReplay )
+        {
+            ( void ) __atomic_fetch_or( &ulPendingInterrupts, 1UL << ulInterruptNumber, __ATOMIC_SEQ_CST );
+
+            /* Interrupt whichever task is running, as the tick does.  If no
+             * task has been created yet the interrupt stays pending until one
+             * runs. */
+            xRunningTask = xTaskGetCurrentTaskHandle();
+
+            if( xRunningTask != NULL )
+            {
+                ( void ) pthread_kill( prvGetThreadFromTask( xRunningTask )->pthread, SIG_INTERRUPT );
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetSimulatedInterruptCounts( uint32_t ulInterruptNumber,
+                                       uint64_t * pullRaised,
+                                       uint64_t * pullHandled )
+{
+    configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+    if( ulInterruptNumber < portMAX_INTERRUPTS )
+    {
+        *pullRaised = __atomic_load_n( &( ullInterruptsRaised[ ulInterruptNumber ] ), __ATOMIC_RELAXED );
+        *pullHandled = __atomic_load_n( &( ullInterruptsHandled[ ulInterruptNumber ] ), __ATOMIC_RELAXED );
+    }
 }
 /*-----------------------------------------------------------*/
 
@@ -463,8 +726,74 @@ static void * prvTimerTickHandler( void * arg )
          * preemption (if enabled)
          */
         Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
-        pthread_kill( thread->pthread, SIGALRM );
-        usleep( portTICK_RATE_MICROSECONDS );
+
+        if( eScheduleMode == eScheduleLogRecord )
+        {
+            /* The tick is normally taken at the next schedule point.  Only
+             * interrupt a task that has not passed a schedule point for a
+             * whole tick period, such as the idle task. */
+            if( __atomic_add_fetch( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST ) > 1U )
+            {
+                pthread_kill( thread->pthread, SIGALRM );
+            }
+
+            usleep( portTICK_RATE_MICROSECONDS );
+        }
+        else if( eScheduleMode == eScheduleLogReplay )
+        {
+            /* Replayed ticks are not tied to real time, so only interrupt
+             * the running task when the log says a tick arrived between the
+             * schedule points it is between. */
+            const ScheduleRecord_t * pxRecord = prvNextReplayRecord();
+
+            if( ( pxRecord != NULL ) &&
+                ( pxRecord->cKind == portSCHEDULE_RECORD_ASYNC_TICK ) &&
+                ( pxRecord->ullPoint == __atomic_load_n( &ullSchedulePoints, __ATOMIC_SEQ_CST ) ) )
+            {
+                pthread_kill( thread->pthread, SIGALRM );
+            }
+            else if( ( pxRecord != NULL ) &&
+                     ( pxRecord->cKind == portSCHEDULE_RECORD_INTERRUPT ) &&
+                     ( pxRecord->ullPoint == __atomic_load_n( &ullSchedulePoints, __ATOMIC_SEQ_CST ) ) )
+            {
+                /* A replayed interrupt is normally taken at the next schedule
+                 * point.  Only interrupt a task that has not passed one for a
+                 * whole tick period, such as a task polling a flag set by the
+                 * handler. */
+                if( xWaitingReplayRecord != __atomic_load_n( &xNextReplayRecord, __ATOMIC_SEQ_CST ) )
+                {
+                    xWaitingReplayRecord = __atomic_load_n( &xNextReplayRecord, __ATOMIC_SEQ_CST );
+                    ulReplayRecordWaitPolls = 0;
+                }
+                else if( ++ulReplayRecordWaitPolls >= ( portTICK_RATE_MICROSECONDS / portSCHEDULE_POLL_MICROSECONDS ) )
+                {
+                    ulReplayRecordWaitPolls = 0;
+                    pthread_kill( thread->pthread, SIG_INTERRUPT );
+                }
+            }
+
+            usleep( portSCHEDULE_POLL_MICROSECONDS );
+        }
+        else if( eScheduleMode == eScheduleLogExplore )
+        {
+            /* Explored ticks are injected at schedule points.  Time must
+             * still advance when every task is blocked, so the idle task is
+             * also ticked.  The idle task does not change the state of any
+             * other task, so where it is interrupted does not change the
+             * interleaving. */
+            if( prvExploreIdleTaskRunning() != pdFALSE )
+            {
+                __atomic_store_n( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST );
+                pthread_kill( thread->pthread, SIGALRM );
+            }
+
+            usleep( portSCHEDULE_POLL_MICROSECONDS );
+        }
+        else
+        {
+            pthread_kill( thread->pthread, SIGALRM );
+            usleep( portTICK_RATE_MICROSECONDS );
+        }
     }
 
     return NULL;
@@ -484,34 +813,219 @@ void prvSetupTimerInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
+static void prvProcessTick( void )
+{
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+
+    uxCriticalNesting++; /* Signals are blocked while the tick is processed. */
+
+    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        /* Select Next Task. */
+        vTaskSwitchContext();
+
+        pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        prvScheduleLogSwitch( pxThreadToResume );
+
+        prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+    }
+
+    uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
 static void vPortSystemTickHandler( int sig )
 {
     if( prvIsFreeRTOSThread() == pdTRUE )
     {
-        Thread_t * pxThreadToSuspend;
-        Thread_t * pxThreadToResume;
-
         ( void ) sig;
 
-        uxCriticalNesting++; /* Signals are blocked in this signal handler. */
+        if( eScheduleMode == eScheduleLogOff )
+        {
+            prvProcessTick();
+        }
+        else
+        {
+            prvTakeScheduledTicks( pdFALSE );
+        }
+    }
+    else
+    {
+        fprintf( stderr, "vPortSystemTickHandler called from non-FreeRTOS thread\n" );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInterruptDispatcher( int sig )
+{
+    Thread_t * pxThreadToSuspend;
+    UBaseType_t uxSavedInterruptPriority = uxCurrentInterruptPriority;
+    uint32_t ulInterruptNumber;
+
+    ( void ) sig;
 
+    if( prvIsFreeRTOSThread() == pdTRUE )
+    {
         pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-        if( xTaskIncrementTick() != pdFALSE )
+        if( pxThreadToSuspend->pthread != pthread_self() )
         {
-            /* Select Next Task. */
-            vTaskSwitchContext();
+            /* This thread stopped running after the interrupt was raised, so
+             * pass the interrupt on to the thread that is running now. */
+            ( void ) pthread_kill( pxThreadToSuspend->pthread, SIG_INTERRUPT );
+        }
+        else
+        {
+            if( eScheduleMode == eScheduleLogReplay )
+            {
+                /* Run the handlers the log says ran before the next schedule
+                 * point, unless they are masked, in which case they run when
+                 * the schedule point that unmasks them is passed. */
+                ( void ) prvReplayInterrupts( prvInterruptMaskPriority() );
+            }
+            else
+            {
+                for( ulInterruptNumber = prvHighestPendingInterrupt();
+                     ulInterruptNumber < portMAX_INTERRUPTS;
+                     ulInterruptNumber = prvHighestPendingInterrupt() )
+                {
+                    ( void ) __atomic_fetch_and( &ulPendingInterrupts, ~( 1UL << ulInterruptNumber ), __ATOMIC_SEQ_CST );
+
+                    if( eScheduleMode == eScheduleLogRecord )
+                    {
+                        prvScheduleLogWrite( portSCHEDULE_RECORD_INTERRUPT, ( uint64_t ) pxThreadToSuspend->uxThreadNumber, ulInterruptNumber );
+                    }
+
+                    /* Let a higher priority interrupt nest while the handler
+                     * runs.  The tick stays blocked. */
+                    pthread_sigmask( SIG_UNBLOCK, &xInterruptSignal, NULL );
+                    prvRunInterruptHandler( ulInterruptNumber );
+                    pthread_sigmask( SIG_BLOCK, &xInterruptSignal, NULL );
+                }
+            }
+
+            /* Only the outermost handler switches task, and only if the task
+             * it interrupted could have been preempted. */
+            if( ( uxSavedInterruptPriority == 0U ) &&
+                ( xInterruptsMasked == pdFALSE ) &&
+                ( uxInterruptMaskPriority == 0U ) )
+            {
+                prvYieldFromInterrupt();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
 
-            pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+static void prvRunInterruptHandler( uint32_t ulInterruptNumber )
+{
+    UBaseType_t uxSavedInterruptPriority = uxCurrentInterruptPriority;
+    uint32_t ulSwitchRequired;
 
-            prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
-        }
+    ( void ) __atomic_add_fetch( &( ullInterruptsHandled[ ulInterruptNumber ] ), 1U, __ATOMIC_RELAXED );
 
-        uxCriticalNesting--;
+    uxCurrentInterruptPriority = ucInterruptPriority[ ulInterruptNumber ];
+
+    if( ulIsrHandler[ ulInterruptNumber ] != NULL )
+    {
+        ulSwitchRequired = ulIsrHandler[ ulInterruptNumber ]();
     }
     else
     {
-        fprintf( stderr, "vPortSystemTickHandler called from non-FreeRTOS thread\n" );
+        ulSwitchRequired = 0;
+    }
+
+    uxCurrentInterruptPriority = uxSavedInterruptPriority;
+
+    if( ulSwitchRequired != 0U )
+    {
+        xInterruptYieldPending = pdTRUE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldFromInterrupt( void )
+{
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+
+    /* Called with signals blocked, when the task that was interrupted could
+     * have been preempted. */
+    if( xInterruptYieldPending != pdFALSE )
+    {
+        xInterruptYieldPending = pdFALSE;
+
+        uxCriticalNesting++; /* Signals are blocked while the task is switched. */
+
+        pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        vTaskSwitchContext();
+
+        pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        prvScheduleLogSwitch( pxThreadToResume );
+
+        prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+
+        uxCriticalNesting--;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvInterruptMaskPriority( void )
+{
+    UBaseType_t uxPriority = uxCurrentInterruptPriority;
+
+    /* Only interrupts with a priority above the returned priority can be
+     * taken now. */
+    if( uxInterruptMaskPriority > uxPriority )
+    {
+        uxPriority = uxInterruptMaskPriority;
+    }
+
+    if( ( xInterruptsMasked != pdFALSE ) && ( uxPriority < portMAX_MASKED_INTERRUPT_PRIORITY ) )
+    {
+        uxPriority = portMAX_MASKED_INTERRUPT_PRIORITY;
+    }
+
+    return uxPriority;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvHighestPendingInterrupt( void )
+{
+    uint32_t ulPending = __atomic_load_n( &ulPendingInterrupts, __ATOMIC_SEQ_CST );
+    uint32_t ulHighest = portMAX_INTERRUPTS;
+    UBaseType_t uxPriority = prvInterruptMaskPriority();
+    uint32_t ulInterruptNumber;
+
+    /* Return the lowest numbered of the highest priority pending interrupts
+     * that are above uxPriority, or portMAX_INTERRUPTS if there are none. */
+    for( ulInterruptNumber = 0; ulInterruptNumber < portMAX_INTERRUPTS; ulInterruptNumber++ )
+    {
+        if( ( ( ulPending & ( 1UL << ulInterruptNumber ) ) != 0U ) &&
+            ( ucInterruptPriority[ ulInterruptNumber ] > uxPriority ) )
+        {
+            uxPriority = ucInterruptPriority[ ulInterruptNumber ];
+            ulHighest = ulInterruptNumber;
+        }
+    }
+
+    return ulHighest;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPendInterruptSignal( void )
+{
+    /* The signal is delivered as soon as this thread unblocks it.  An
+     * interrupt that is still masked is taken when it is unmasked. */
+    if( prvHighestPendingInterrupt() < portMAX_INTERRUPTS )
+    {
+        ( void ) pthread_kill( pthread_self(), SIG_INTERRUPT );
     }
 }
 /*-----------------------------------------------------------*/
@@ -574,6 +1088,7 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
                              Thread_t * pxThreadToSuspend )
 {
     BaseType_t uxSavedCriticalNesting;
+    BaseType_t xSavedInterruptsMasked;
 
     if( pxThreadToSuspend != pxThreadToResume )
     {
@@ -585,6 +1100,7 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
          * we switch back to this task.
          */
         uxSavedCriticalNesting = uxCriticalNesting;
+        xSavedInterruptsMasked = xInterruptsMasked;
 
         prvResumeThread( pxThreadToResume );
 
@@ -596,6 +1112,11 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
         prvSuspendSelf( pxThreadToSuspend );
 
         uxCriticalNesting = uxSavedCriticalNesting;
+        xInterruptsMasked = xSavedInterruptsMasked;
+
+        /* Take any interrupt raised while this thread was suspended once
+         * this thread unblocks SIG_INTERRUPT. */
+        prvPendInterruptSignal();
     }
 }
 /*-----------------------------------------------------------*/
@@ -644,6 +1165,13 @@ static void prvSetupSignalsAndSchedulerPolicy( void )
      * in a critical section. */
     sigdelset( &xAllSignals, SIGINT );
 
+    /* Critical sections leave simulated interrupts above
+     * configMAX_SYSCALL_INTERRUPT_PRIORITY unmasked. */
+    sigemptyset( &xInterruptSignal );
+    sigaddset( &xInterruptSignal, SIG_INTERRUPT );
+    xMaskableSignals = xAllSignals;
+    sigdelset( &xMaskableSignals, SIG_INTERRUPT );
+
     /*
      * Block all signals in this thread so all new threads
      * inherits this mask.
@@ -665,6 +1193,15 @@ static void prvSetupSignalsAndSchedulerPolicy( void )
     {
         prvFatalError( "sigaction", errno );
     }
+
+    sigtick.sa_handler = prvInterruptDispatcher;
+
+    iRet = sigaction( SIG_INTERRUPT, &sigtick, NULL );
+
+    if( iRet == -1 )
+    {
+        prvFatalError( "sigaction", errno );
+    }
 }
 /*-----------------------------------------------------------*/
 
@@ -677,3 +1214,450 @@ uint32_t ulPortGetRunTime( void )
     return ( uint32_t ) xTimes.tms_utime;
 }
 /*-----------------------------------------------------------*/
+
+BaseType_t xPortRecordSchedule( const char * pcFileName )
+{
+    BaseType_t xReturn = pdFAIL;
+
+    configASSERT( eScheduleMode == eScheduleLogOff );
+
+    iScheduleLogFile = open( pcFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+
+    if( iScheduleLogFile != -1 )
+    {
+        ullSchedulePoints = 0;
+        ulPendingTicks = 0;
+        eScheduleMode = eScheduleLogRecord;
+        xReturn = pdPASS;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortScheduleReplayComplete( void )
+{
+    return __atomic_load_n( &xReplayComplete, __ATOMIC_SEQ_CST );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortExploreSchedule( uint32_t ulSeed,
+                                 uint32_t ulPreemptOneIn )
+{
+    BaseType_t xReturn = pdFAIL;
+    struct sigaction xAbortAction;
+
+    configASSERT( eScheduleMode == eScheduleLogOff );
+
+    /* The idle task must be known, as it is the only task ticked in real
+     * time. */
+    if( ( ulPreemptOneIn > 0U ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
+    {
+        ulExploreSeed = ulSeed;
+        ulExploreOneIn = ulPreemptOneIn;
+
+        /* The generator must not be seeded with zero. */
+        ulExploreState = ( ulSeed != 0U ) ? ulSeed : 0x9E3779B9U;
+
+        /* Report the seed if the application fails an assert, so the failing
+         * interleaving can be run again. */
+        memset( &xAbortAction, 0, sizeof( xAbortAction ) );
+        xAbortAction.sa_handler = prvExploreAbortHandler;
+        sigemptyset( &xAbortAction.sa_mask );
+
+        if( sigaction( SIGABRT, &xAbortAction, &xExploreOriginalAbortAction ) != 0 )
+        {
+            prvFatalError( "sigaction", errno );
+        }
+
+        ullSchedulePoints = 0;
+        ulPendingTicks = 0;
+        eScheduleMode = eScheduleLogExplore;
+        xReturn = pdPASS;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortReplaySchedule( const char * pcFileName )
+{
+    BaseType_t xReturn = pdPASS;
+    FILE * pxFile;
+    ScheduleRecord_t xRecord;
+    ScheduleRecord_t * pxNewRecords;
+    size_t xCapacity = 0;
+    char pcLine[ 64 ];
+    int iFields;
+
+    configASSERT( eScheduleMode == eScheduleLogOff );
+
+    pxFile = fopen( pcFileName, "r" );
+
+    if( pxFile == NULL )
+    {
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        xReplayRecordCount = 0;
+
+        while( ( xReturn == pdPASS ) && ( fgets( pcLine, ( int ) sizeof( pcLine ), pxFile ) != NULL ) )
+        {
+            xRecord.ullThread = 0;
+            xRecord.ulInterrupt = 0;
+            iFields = sscanf( pcLine, "%c %" SCNu64 " %" SCNu64 " %" SCNu32, &xRecord.cKind, &xRecord.ullPoint, &xRecord.ullThread, &xRecord.ulInterrupt );
+
+            if( ( ( xRecord.cKind == portSCHEDULE_RECORD_SWITCH ) && ( iFields != 3 ) ) ||
+                ( ( xRecord.cKind == portSCHEDULE_RECORD_INTERRUPT ) && ( ( iFields != 4 ) || ( xRecord.ulInterrupt >= portMAX_INTERRUPTS ) ) ) ||
+                ( ( xRecord.cKind != portSCHEDULE_RECORD_SWITCH ) && ( xRecord.cKind != portSCHEDULE_RECORD_INTERRUPT ) && ( xRecord.cKind != portSCHEDULE_RECORD_TICK ) && ( xRecord.cKind != portSCHEDULE_RECORD_ASYNC_TICK ) ) ||
+                ( iFields < 2 ) )
+            {
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                if( xReplayRecordCount == xCapacity )
+                {
+                    xCapacity = ( xCapacity == 0 ) ? 1024 : ( xCapacity * 2 );
+                    pxNewRecords = realloc( pxReplayRecords, xCapacity * sizeof( ScheduleRecord_t ) );
+
+                    if( pxNewRecords == NULL )
+                    {
+                        prvFatalError( "realloc", ENOMEM );
+                    }
+
+                    pxReplayRecords = pxNewRecords;
+                }
+
+                pxReplayRecords[ xReplayRecordCount++ ] = xRecord;
+            }
+        }
+
+        ( void ) fclose( pxFile );
+
+        if( xReturn == pdPASS )
+        {
+            ullSchedulePoints = 0;
+            xNextReplayRecord = 0;
+            xWaitingReplayRecord = 0;
+            ulReplayRecordWaitPolls = 0;
+            xReplayComplete = pdFALSE;
+            eScheduleMode = eScheduleLogReplay;
+        }
+        else
+        {
+            free( pxReplayRecords );
+            pxReplayRecords = NULL;
+        }
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSchedulePoint( void )
+{
+    const ScheduleRecord_t * pxRecord;
+
+    /* The idle task passes a number of schedule points that depends on how
+     * long the host takes to tick it, so they are not counted when exploring.
+     * Otherwise they would shift every choice made after them. */
+    if( ( eScheduleMode != eScheduleLogExplore ) || ( prvExploreIdleTaskRunning() == pdFALSE ) )
+    {
+        /* Called with signals blocked, outside of any critical section, so a
+         * tick can be processed here as if it arrived just before interrupts
+         * were disabled or just after they were enabled. */
+        prvTakeScheduledTicks( pdTRUE );
+
+        ( void ) __atomic_add_fetch( &ullSchedulePoints, 1U, __ATOMIC_SEQ_CST );
+
+        if( eScheduleMode == eScheduleLogReplay )
+        {
+            /* A handler above configMAX_SYSCALL_INTERRUPT_PRIORITY may also
+             * have run inside the critical section that this schedule point
+             * starts.  It cannot call the kernel, so running it here does not
+             * change the interleaving, and keeps it ahead of any context switch
+             * logged for the critical section. */
+            ( void ) prvReplayInterrupts( portMAX_MASKED_INTERRUPT_PRIORITY );
+
+            pxRecord = prvNextReplayRecord();
+
+            if( ( pxRecord != NULL ) && ( pxRecord->ullPoint < ullSchedulePoints ) )
+            {
+                prvReplayDiverged( "a recorded event did not happen" );
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTakeScheduledTicks( BaseType_t xAtSchedulePoint )
+{
+    const ScheduleRecord_t * pxRecord;
+
+    if( eScheduleMode == eScheduleLogRecord )
+    {
+        /* Take every tick raised by the timer tick thread since the last
+         * schedule point. */
+        while( __atomic_load_n( &ulPendingTicks, __ATOMIC_SEQ_CST ) > 0U )
+        {
+            ( void ) __atomic_sub_fetch( &ulPendingTicks, 1U, __ATOMIC_SEQ_CST );
+            prvScheduleLogWrite( ( xAtSchedulePoint != pdFALSE ) ? portSCHEDULE_RECORD_TICK : portSCHEDULE_RECORD_ASYNC_TICK, 0, 0 );
+            prvProcessTick();
+        }
+    }
+    else if( eScheduleMode == eScheduleLogReplay )
+    {
+        /* Take the ticks, and run the interrupt handlers, the log says
+         * arrived before this schedule point.  Ticks that were taken at a
+         * schedule point are never taken by the SIGALRM handler.  Neither
+         * handler runs inside a critical section, so an interrupt is taken as
+         * if it arrived while interrupts were enabled. */
+        for( ; ; )
+        {
+            pxRecord = prvNextReplayRecord();
+
+            if( ( pxRecord == NULL ) ||
+                ( pxRecord->ullPoint != ullSchedulePoints ) ||
+                ( pxRecord->cKind == portSCHEDULE_RECORD_SWITCH ) ||
+                ( ( pxRecord->cKind == portSCHEDULE_RECORD_TICK ) && ( xAtSchedulePoint == pdFALSE ) ) )
+            {
+                break;
+            }
+
+            if( pxRecord->cKind == portSCHEDULE_RECORD_INTERRUPT )
+            {
+                if( prvReplayInterrupts( 0 ) == pdFALSE )
+                {
+                    prvReplayDiverged( "a recorded interrupt has no priority" );
+                }
+
+                prvYieldFromInterrupt();
+            }
+            else
+            {
+                prvConsumeReplayRecord();
+                prvProcessTick();
+            }
+        }
+    }
+    else if( eScheduleMode == eScheduleLogExplore )
+    {
+        /* Only the idle task is ticked by the timer tick thread.  A tick
+         * that arrives after the idle task was switched out is dropped. */
+        if( __atomic_exchange_n( &ulPendingTicks, 0U, __ATOMIC_SEQ_CST ) != 0U )
+        {
+            if( ( xAtSchedulePoint == pdFALSE ) && ( prvExploreIdleTaskRunning() != pdFALSE ) )
+            {
+                prvProcessTick();
+            }
+        }
+
+        if( xAtSchedulePoint != pdFALSE )
+        {
+            prvExploreSchedulePoint();
+        }
+    }
+    else
+    {
+        /* The replay finished, so ticks are delivered in real time again. */
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvScheduleLogSwitch( const Thread_t * pxThread )
+{
+    const ScheduleRecord_t * pxRecord;
+
+    if( eScheduleMode == eScheduleLogRecord )
+    {
+        prvScheduleLogWrite( portSCHEDULE_RECORD_SWITCH, ( uint64_t ) pxThread->uxThreadNumber, 0 );
+    }
+    else if( eScheduleMode == eScheduleLogReplay )
+    {
+        pxRecord = prvNextReplayRecord();
+
+        if( ( pxRecord == NULL ) ||
+            ( pxRecord->cKind != portSCHEDULE_RECORD_SWITCH ) ||
+            ( pxRecord->ullPoint != ullSchedulePoints ) ||
+            ( pxRecord->ullThread != ( uint64_t ) pxThread->uxThreadNumber ) )
+        {
+            prvReplayDiverged( "a different task was selected" );
+        }
+
+        prvConsumeReplayRecord();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvScheduleLogWrite( char cKind,
+                                 uint64_t ullThread,
+                                 uint32_t ulInterruptNumber )
+{
+    char pcLine[ 64 ];
+    int iLength;
+
+    /* Each record is written straight to the file, so the log is complete
+     * even if the application aborts. */
+    if( cKind == portSCHEDULE_RECORD_SWITCH )
+    {
+        iLength = snprintf( pcLine, sizeof( pcLine ), "%c %" PRIu64 " %" PRIu64 "\n", cKind, ullSchedulePoints, ullThread );
+    }
+    else if( cKind == portSCHEDULE_RECORD_INTERRUPT )
+    {
+        iLength = snprintf( pcLine, sizeof( pcLine ), "%c %" PRIu64 " %" PRIu64 " %" PRIu32 "\n", cKind, ullSchedulePoints, ullThread, ulInterruptNumber );
+    }
+    else
+    {
+        iLength = snprintf( pcLine, sizeof( pcLine ), "%c %" PRIu64 "\n", cKind, ullSchedulePoints );
+    }
+
+    if( write( iScheduleLogFile, pcLine, ( size_t ) iLength ) != ( ssize_t ) iLength )
+    {
+        prvFatalError( "write", errno );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static const ScheduleRecord_t * prvNextReplayRecord( void )
+{
+    const ScheduleRecord_t * pxRecord = NULL;
+    size_t xNext = __atomic_load_n( &xNextReplayRecord, __ATOMIC_SEQ_CST );
+
+    if( xNext < xReplayRecordCount )
+    {
+        pxRecord = &( pxReplayRecords[ xNext ] );
+    }
+
+    return pxRecord;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReplayInterrupts( UBaseType_t uxMaskPriority )
+{
+    const ScheduleRecord_t * pxRecord;
+    uint32_t ulInterruptNumber;
+    BaseType_t xReturn = pdFALSE;
+
+    /* Run, one after the other, the handlers the log says ran next, stopping
+     * at a record of another kind or at a handler that is masked at
+     * uxMaskPriority.  Handlers that nested when the log was recorded run
+     * after the handler they interrupted. */
+    for( ; ; )
+    {
+        pxRecord = prvNextReplayRecord();
+
+        if( ( pxRecord == NULL ) ||
+            ( pxRecord->cKind != portSCHEDULE_RECORD_INTERRUPT ) ||
+            ( pxRecord->ullPoint != ullSchedulePoints ) ||
+            ( ucInterruptPriority[ pxRecord->ulInterrupt ] <= uxMaskPriority ) )
+        {
+            break;
+        }
+
+        if( pxRecord->ullThread != ( uint64_t ) prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->uxThreadNumber )
+        {
+            prvReplayDiverged( "an interrupt was taken by a different task" );
+        }
+
+        ulInterruptNumber = pxRecord->ulInterrupt;
+        prvConsumeReplayRecord();
+        prvRunInterruptHandler( ulInterruptNumber );
+        xReturn = pdTRUE;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumeReplayRecord( void )
+{
+    if( __atomic_add_fetch( &xNextReplayRecord, 1U, __ATOMIC_SEQ_CST ) == xReplayRecordCount )
+    {
+        /* The whole log has been replayed, so carry on in real time.  The
+         * application can poll xPortScheduleReplayComplete() to find out. */
+        __atomic_store_n( &xReplayComplete, pdTRUE, __ATOMIC_SEQ_CST );
+        eScheduleMode = eScheduleLogOff;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvReplayDiverged( const char * pcReason )
+{
+    fprintf( stderr, "Schedule replay diverged at record %lu, schedule point %" PRIu64 ": %s\n",
+             ( unsigned long ) xNextReplayRecord, ullSchedulePoints, pcReason );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+static void prvExploreSchedulePoint( void )
+{
+    /* A tick may arrive between any two schedule points, and with time slicing
+     * the tick may also switch to another task of the same priority.  Inject
+     * both here.  A higher priority task is never preempted by a lower one, as
+     * that could not happen on a target. */
+    if( ( prvExploreRandom() % ulExploreOneIn ) == 0U )
+    {
+        prvProcessTick();
+    }
+
+    #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        else if( ( prvExploreRandom() % ulExploreOneIn ) == 0U )
+        {
+            uxCriticalNesting++;
+            prvPortYieldFromISR();
+            uxCriticalNesting--;
+        }
+    #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvExploreIdleTaskRunning( void )
+{
+    BaseType_t xReturn = pdFALSE;
+
+    #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+    {
+        if( xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle() )
+        {
+            xReturn = pdTRUE;
+        }
+    }
+    #endif
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvExploreRandom( void )
+{
+    /* xorshift32, so each seed gives the same sequence on every host. */
+    ulExploreState ^= ulExploreState << 13;
+    ulExploreState ^= ulExploreState >> 17;
+    ulExploreState ^= ulExploreState << 5;
+
+    return ulExploreState;
+}
+/*-----------------------------------------------------------*/
+
+static void prvExploreAbortHandler( int sig )
+{
+    char pcMessage[ 128 ];
+    int iLength;
+
+    iLength = snprintf( pcMessage, sizeof( pcMessage ),
+                        "Schedule exploration failed at schedule point %" PRIu64 ": xPortExploreSchedule( %" PRIu32 ", %" PRIu32 " ) repeats it\n",
+                        ullSchedulePoints, ulExploreSeed, ulExploreOneIn );
+    ( void ) write( STDERR_FILENO, pcMessage, ( size_t ) iLength );
+
+    /* Let the abort carry on as it would have done. */
+    ( void ) sigaction( SIGABRT, &xExploreOriginalAbortAction, NULL );
+    ( void ) raise( sig );
+}
+/*-----------------------------------------------------------*/
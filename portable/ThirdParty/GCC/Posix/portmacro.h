@@ -117,6 +117,11 @@ extern void vPortExitCritical( void );
 #define portENTER_CRITICAL()                      vPortEnterCritical()
 #define portEXIT_CRITICAL()                       vPortExitCritical()
 
+#if ( configASSERT_DEFINED == 1 )
+    void vPortValidateInterruptPriority( void );
+    #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()    vPortValidateInterruptPriority()
+#endif
+
 /*-----------------------------------------------------------*/
 
 extern void vPortThreadDying( void * pxTaskToDelete,
@@ -143,6 +148,115 @@ extern void vPortCancelThread( void * pxTaskToDelete );
 extern uint32_t ulPortGetRunTime( void );
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* no-op */
 #define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
+/*-----------------------------------------------------------*/
+
+/*
+ * Deterministic schedule record and replay.
+ *
+ * A schedule point is passed each time a task disables or enables interrupts
+ * outside of a critical section.  While recording, the tick is taken at the
+ * first schedule point after the timer raises it, and the number of schedule
+ * points passed before each tick and each context switch is written to the
+ * log file.  While replaying, the tick is taken at the schedule points found
+ * in the log instead of in real time, so a run that failed once can be
+ * repeated, under a debugger if needed, with the same interleaving of tasks.
+ * Replay aborts with a message on stderr if the application diverges from the
+ * log, and continues in real time once the whole log has been replayed, which
+ * xPortScheduleReplayComplete() reports.
+ *
+ * A task that busy-waits without calling the kernel for a whole tick period
+ * can only be preempted asynchronously, between two schedule points.  Such
+ * ticks are recorded and replayed, but the code they interrupt is not
+ * guaranteed to have made the same progress in both runs.
+ *
+ * Each run of a simulated interrupt handler is also logged, with the
+ * interrupt number and the task it interrupted.  While replaying, raising a
+ * simulated interrupt has no effect other than counting the raise.  Instead
+ * the handler runs at the next schedule point after the one the log says it
+ * followed, or asynchronously if the running task does not reach that schedule
+ * point within a tick period.  Handlers that nested run one after the other.
+ * Host threads that are not tasks are not replayed, so the replay is only
+ * faithful if a handler does not depend on data such a thread writes.
+ *
+ * Call one of these functions before vTaskStartScheduler().  Each returns
+ * pdPASS on success, or pdFAIL if the file cannot be opened or parsed.
+ */
+BaseType_t xPortRecordSchedule( const char * pcFileName );
+BaseType_t xPortReplaySchedule( const char * pcFileName );
+
+/*
+ * Returns pdTRUE once every record of the log passed to xPortReplaySchedule()
+ * has been replayed, otherwise pdFALSE.  Can be called from any thread.
+ */
+BaseType_t xPortScheduleReplayComplete( void );
+
+/*
+ * Systematic schedule exploration.
+ *
+ * At each schedule point, inject a tick with a probability of one in
+ * ulPreemptOneIn and, when configUSE_PREEMPTION and configUSE_TIME_SLICING are
+ * both 1, otherwise switch to the next ready task of the same priority with
+ * the same probability.  The choices come from a pseudo random sequence
+ * started from ulSeed, and ticks are not taken in real time, so each seed
+ * gives a different interleaving that is the same every time the seed is run.
+ * So that time still advances when every task is blocked, the idle task is
+ * ticked every few microseconds, and its own schedule points are ignored.
+ * The interleaving is therefore only repeatable if the idle task hook does
+ * not change the state of other tasks, and if no task busy-waits for the
+ * tick count to change without blocking.  Simulated interrupts are not
+ * explored.
+ *
+ * If the application aborts, for example from a failed configASSERT(), the
+ * seed is written to stderr.  Run each seed in its own process, or end and
+ * restart the scheduler between seeds.
+ *
+ * Call before vTaskStartScheduler().  Returns pdPASS, or pdFAIL if
+ * ulPreemptOneIn is zero or INCLUDE_xTaskGetIdleTaskHandle is not 1.
+ */
+BaseType_t xPortExploreSchedule( uint32_t ulSeed,
+                                 uint32_t ulPreemptOneIn );
+/*-----------------------------------------------------------*/
+
+/*
+ * Simulated interrupt controller.
+ *
+ * There are 32 interrupt lines, numbered 0 to 31, none of which are used by
+ * the kernel.  Each line has a priority from 1 (lowest, the default) to 255
+ * (highest).  A pending interrupt runs on the thread of the task that is
+ * running, and a higher priority interrupt nests inside a lower priority
+ * handler.  Critical sections and portSET_INTERRUPT_MASK_FROM_ISR() mask
+ * lines at or below configMAX_SYSCALL_INTERRUPT_PRIORITY, which defaults to
+ * 255 in this port so that every line is masked.  A value of 0, as used by
+ * configurations written for other ports, also masks every line.  Only lines
+ * that are masked may call FreeRTOS API functions.  The tick is not a
+ * simulated interrupt, so a simulated interrupt does not nest inside the tick.
+ *
+ * Interrupt handler functions must return a non-zero value if executing the
+ * handler resulted in a task switch being required, as on the Windows port.
+ *
+ * Simulated interrupts are recorded and replayed by the schedule functions
+ * above, but are not explored.
+ */
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber,
+                               uint32_t ( * pvHandler )( void ) );
+void vPortSetInterruptPriority( uint32_t ulInterruptNumber,
+                                uint32_t ulPriority );
+
+/*
+ * Raise a simulated interrupt.  Can be called from a task, from an interrupt
+ * handler or from any other host thread.  Raising a line that is already
+ * pending has no further effect, as with a level triggered interrupt.
+ */
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber );
+
+/*
+ * Return how many times a line has been raised and how many times its handler
+ * has run.  The difference is the number of raises that were merged while the
+ * line was pending.
+ */
+void vPortGetSimulatedInterruptCounts( uint32_t ulInterruptNumber,
+                                       uint64_t * pullRaised,
+                                       uint64_t * pullHandled );
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -152,6 +152,11 @@ extern void vPortYield( void );
 void vYieldCore( int xCoreID );
 #define portYIELD_CORE( a )                  vYieldCore( a )
 
+/* A core running a passive idle task sleeps until an interrupt, such as the
+ * SIO FIFO interrupt raised by vYieldCore(), or an event.  The passive idle
+ * hook, if used, therefore runs once per wake up rather than continuously. */
+#define portPASSIVE_IDLE_WAIT()              __wfe()
+
 /*-----------------------------------------------------------*/
 
 /* Critical nesting count management. */
@@ -116,6 +116,11 @@ static void prvTaskExitError( void );
     static UBaseType_t uxCriticalNesting;
 #else /* #if ( configNUMBER_OF_CORES == 1 ) */
 UBaseType_t uxCriticalNestings[ configNUMBER_OF_CORES ] = { 0 };
+
+/* Set by vYieldCore() when it pushes to the SIO FIFO of a core, and cleared by
+ * that core's FIFO interrupt handler.  Further yield requests made while the
+ * flag is set are covered by the interrupt already pending, so do not push. */
+static volatile uint32_t ulYieldPending[ configNUMBER_OF_CORES ] = { 0 };
 #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 
 /*-----------------------------------------------------------*/
@@ -277,7 +282,7 @@ void vPortStartFirstTask( void )
 }
 /*-----------------------------------------------------------*/
 
-#if ( LIB_PICO_MULTICORE == 1 ) && ( configSUPPORT_PICO_SYNC_INTEROP == 1 )
+#if ( LIB_PICO_MULTICORE == 1 ) && ( ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) || ( configNUMBER_OF_CORES > 1 ) )
     static void prvFIFOInterruptHandler()
     {
         /* We must remove the contents (which we don't care about)
@@ -288,6 +293,15 @@ void vPortStartFirstTask( void )
         multicore_fifo_clear_irq();
 
         #if ( configNUMBER_OF_CORES != 1 )
+
+            /* Clear the flag only once the FIFO is empty.  A yield requested
+             * before this point saw the flag set and did not push, but the
+             * yield below is taken after it, so it is still honoured.  A
+             * yield requested after this point pushes a new word, which
+             * raises the interrupt again rather than being drained above. */
+            __dmb();
+            ulYieldPending[ portGET_CORE_ID() ] = 0;
+            __dmb();
             portYIELD_FROM_ISR( pdTRUE );
         #elif ( configSUPPORT_PICO_SYNC_INTEROP == 1 )
             BaseType_t xHigherPriorityTaskWoken = pdFALSE;
@@ -299,7 +313,7 @@ void vPortStartFirstTask( void )
             portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
         #endif /* configNUMBER_OF_CORES != 1 */
     }
-#endif /* if ( LIB_PICO_MULTICORE == 1 ) && ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) */
+#endif /* if ( LIB_PICO_MULTICORE == 1 ) && ( ( configSUPPORT_PICO_SYNC_INTEROP == 1 ) || ( configNUMBER_OF_CORES > 1 ) ) */
 
 #if ( configNUMBER_OF_CORES > 1 )
 
@@ -517,9 +531,18 @@ void vYieldCore( int xCoreID )
 
     #if configNUMBER_OF_CORES != 1
 
-        /* Non blocking, will cause interrupt on other core if the queue isn't already full,
-         * in which case an IRQ must be pending */
-        sio_hw->fifo_wr = 0;
+        /* The kernel calls this with interrupts disabled, and only this core
+         * sets the flag, so it cannot be set between the test and the write
+         * below. */
+        if( ulYieldPending[ xCoreID ] == 0 )
+        {
+            ulYieldPending[ xCoreID ] = 1;
+            __dmb();
+
+            /* Non blocking, will cause interrupt on other core if the queue isn't already full,
+             * in which case an IRQ must be pending */
+            sio_hw->fifo_wr = 0;
+        }
     #endif
 }
 
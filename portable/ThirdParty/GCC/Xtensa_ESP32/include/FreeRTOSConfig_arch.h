@@ -39,8 +39,10 @@
 
 #include "sdkconfig.h"
 
-/* enable use of optimized task selection by the scheduler */
-#if defined( CONFIG_FREERTOS_OPTIMIZED_SCHEDULER ) && !defined( configUSE_PORT_OPTIMISED_TASK_SELECTION )
+/* enable use of optimized task selection by the scheduler (not supported by
+ * the SMP kernel, so only when configNUMBER_OF_CORES is 1) */
+#if defined( CONFIG_FREERTOS_OPTIMIZED_SCHEDULER ) && !defined( configUSE_PORT_OPTIMISED_TASK_SELECTION ) && \
+    !( defined( configNUMBER_OF_CORES ) && ( configNUMBER_OF_CORES > 1 ) )
     #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
 #endif
 
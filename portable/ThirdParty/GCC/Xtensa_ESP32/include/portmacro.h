@@ -201,8 +201,20 @@
     #define portEXIT_CRITICAL( ... )         do { vTaskExitCritical(); vPortConsumeSpinlockArg( 0, ## __VA_ARGS__ ); } while( 0 )
 
 
-    #define portENTER_CRITICAL_ISR( mux )    vPortCPUAcquireMutexTimeout( mux, portMUX_NO_TIMEOUT )
-    #define portEXIT_CRITICAL_ISR( mux )     vPortCPUReleaseMutex( mux )
+    #if ( configNUMBER_OF_CORES > 1 )
+
+/* With the native SMP kernel the ISR variants use the kernel's ISR lock, the
+ * same lock portENTER_CRITICAL() takes, so a task on one core and an ISR on the
+ * other core are serialised regardless of which mux each passes in. */
+        void vPortEnterCriticalISR( void );
+        void vPortExitCriticalISR( void );
+
+        #define portENTER_CRITICAL_ISR( mux )    do { vPortEnterCriticalISR(); vPortConsumeSpinlockArg( 0, mux ); } while( 0 )
+        #define portEXIT_CRITICAL_ISR( mux )     do { vPortExitCriticalISR(); vPortConsumeSpinlockArg( 0, mux ); } while( 0 )
+    #else
+        #define portENTER_CRITICAL_ISR( mux )    vPortCPUAcquireMutexTimeout( mux, portMUX_NO_TIMEOUT )
+        #define portEXIT_CRITICAL_ISR( mux )     vPortCPUReleaseMutex( mux )
+    #endif /* if ( configNUMBER_OF_CORES > 1 ) */
 
     #define portENTER_CRITICAL_SAFE( mux ) \
     do {                                   \
@@ -480,7 +492,7 @@
     #define xPortGetFreeHeapSize               esp_get_free_heap_size
     #define xPortGetMinimumEverFreeHeapSize    esp_get_minimum_free_heap_size
 
-    #if ( ESP_IDF_VERSION < ESP_IDF_VERSION_VAL( 4, 2, 0 ) )
+    #if ( ESP_IDF_VERSION < ESP_IDF_VERSION_VAL( 4, 2, 0 ) ) || ( configNUMBER_OF_CORES > 1 )
 
 /*
  * Send an interrupt to another core in order to make the task running
@@ -489,7 +501,7 @@
 
         void vPortYieldOtherCore( BaseType_t coreid ) PRIVILEGED_FUNCTION;
 
-    #endif /* ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 2, 0) */
+    #endif /* ( ESP_IDF_VERSION < ESP_IDF_VERSION_VAL( 4, 2, 0 ) ) || ( configNUMBER_OF_CORES > 1 ) */
 
 /*
  * Callback to set a watchpoint on the end of the stack. Called every context switch to change the stack
@@ -535,6 +547,55 @@
 /* Get tick rate per second */
     uint32_t xPortGetTickRateHz( void );
 
+/*-----------------------------------------------------------*/
+
+/*
+ * Native SMP support.
+ *
+ * When configNUMBER_OF_CORES is set to 2 the port runs the kernel's own SMP
+ * scheduler (the configNUMBER_OF_CORES > 1 paths in tasks.c) on both cores:
+ * - The kernel's task and ISR locks are two recursive portmux spinlocks.
+ * - portYIELD_CORE() sends a cross-core interrupt to the other core.
+ * - Only core 0 runs the tick interrupt; the kernel yields core 1 when
+ *   required.
+ * - The PRO CPU starts the scheduler from vTaskStartScheduler(). The APP CPU
+ *   joins it from esp_startup_start_app_other_cores().
+ *
+ * CONFIG_FREERTOS_UNICORE must not be set in this mode.
+ */
+    #if ( configNUMBER_OF_CORES > 1 )
+
+        #if ( configNUMBER_OF_CORES != portNUM_PROCESSORS )
+            #error configNUMBER_OF_CORES must be 1 or equal to portNUM_PROCESSORS.
+        #endif
+
+        #if CONFIG_FREERTOS_UNICORE
+            #error configNUMBER_OF_CORES cannot be greater than 1 when CONFIG_FREERTOS_UNICORE is set.
+        #endif
+
+        #define portGET_CORE_ID()                   xPortGetCoreID()
+        #define portYIELD_CORE( xCoreID )           vPortYieldOtherCore( xCoreID )
+        #define portCHECK_IF_IN_ISR()               xPortInIsrContext()
+
+        #define portSET_INTERRUPT_MASK()            xPortSetInterruptMaskFromISR()
+        #define portCLEAR_INTERRUPT_MASK( x )       vPortClearInterruptMaskFromISR( x )
+
+        UBaseType_t vTaskEnterCriticalFromISR( void );
+        void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
+        #define portENTER_CRITICAL_FROM_ISR()       vTaskEnterCriticalFromISR()
+        #define portEXIT_CRITICAL_FROM_ISR( x )     vTaskExitCriticalFromISR( x )
+
+        extern portMUX_TYPE port_xTaskLock;
+        extern portMUX_TYPE port_xISRLock;
+
+/* The portmux spinlocks are recursive per core, as the kernel requires. */
+        #define portGET_TASK_LOCK( xCoreID )        do { ( void ) ( xCoreID ); ( void ) vPortCPUAcquireMutexTimeout( &port_xTaskLock, portMUX_NO_TIMEOUT ); } while( 0 )
+        #define portRELEASE_TASK_LOCK( xCoreID )    do { ( void ) ( xCoreID ); vPortCPUReleaseMutex( &port_xTaskLock ); } while( 0 )
+        #define portGET_ISR_LOCK( xCoreID )         do { ( void ) ( xCoreID ); ( void ) vPortCPUAcquireMutexTimeout( &port_xISRLock, portMUX_NO_TIMEOUT ); } while( 0 )
+        #define portRELEASE_ISR_LOCK( xCoreID )     do { ( void ) ( xCoreID ); vPortCPUReleaseMutex( &port_xISRLock ); } while( 0 )
+
+    #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
     static inline bool IRAM_ATTR xPortCanYield( void )
     {
         uint32_t ps_reg = 0;
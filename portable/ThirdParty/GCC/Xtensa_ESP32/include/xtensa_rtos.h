@@ -67,6 +67,15 @@
  */
 #include    "FreeRTOSConfig.h"
 
+/*
+ * The SMP kernel keeps one current TCB per core in pxCurrentTCBs[]. The
+ * assembly sources always index pxCurrentTCB by core ID, so in SMP builds
+ * they can use the kernel's array directly.
+ */
+#if defined( __ASSEMBLER__ ) && defined( configNUMBER_OF_CORES ) && ( configNUMBER_OF_CORES > 1 )
+    #define pxCurrentTCB    pxCurrentTCBs
+#endif
+
 /*
  * Convert FreeRTOSConfig definitions to XTENSA definitions.
  * However these can still be overridden from the command line.
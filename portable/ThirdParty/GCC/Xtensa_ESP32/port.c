@@ -103,6 +103,17 @@ _Static_assert( tskNO_AFFINITY == CONFIG_FREERTOS_NO_AFFINITY, "incorrect tskNO_
 extern volatile int port_xSchedulerRunning[ portNUM_PROCESSORS ];
 unsigned port_interruptNesting[ portNUM_PROCESSORS ] = { 0 }; /* Interrupt nesting level. Increased/decreased in portasm.c, _frxt_int_enter/_frxt_int_exit */
 
+#if ( configNUMBER_OF_CORES > 1 )
+    /* The kernel's task and ISR locks, see portGET_TASK_LOCK() and portGET_ISR_LOCK(). */
+    portMUX_TYPE port_xTaskLock = portMUX_INITIALIZER_UNLOCKED;
+    portMUX_TYPE port_xISRLock = portMUX_INITIALIZER_UNLOCKED;
+
+    /* Nesting of portENTER_CRITICAL_ISR() on each core, and the interrupt
+     * status to restore when the outermost call exits. */
+    static UBaseType_t port_uxISRCriticalNesting[ portNUM_PROCESSORS ] = { 0 };
+    static UBaseType_t port_uxISRSavedInterruptStatus[ portNUM_PROCESSORS ] = { 0 };
+#endif /* configNUMBER_OF_CORES > 1 */
+
 /*-----------------------------------------------------------*/
 
 /* User exception dispatcher when exiting */
@@ -129,7 +140,8 @@ void _xt_user_exit( void );
     StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
                                          TaskFunction_t pxCode,
                                          void * pvParameters,
-                                         BaseType_t xRunPrivileged )
+                                         BaseType_t xRunPrivileged,
+                                         xMPU_SETTINGS * xMPUSettings )
 #else
     StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
                                          TaskFunction_t pxCode,
@@ -267,8 +279,19 @@ BaseType_t xPortStartScheduler( void )
         _xt_coproc_init();
     #endif
 
-    /* Setup the hardware to generate the tick */
-    vPortSetupTimer();
+    #if ( configNUMBER_OF_CORES == 1 )
+        /* Setup the hardware to generate the tick */
+        vPortSetupTimer();
+    #else
+
+        /* The kernel's SMP scheduler expects a single core to call
+         * xTaskIncrementTick(), and yields the other core itself when
+         * required, so only core 0 sets up the tick. */
+        if( xPortGetCoreID() == 0 )
+        {
+            vPortSetupTimer();
+        }
+    #endif
 
     /* NOTE: For ESP32-S3, vPortSetupTimer allocates an interrupt for the
      * systimer which is used as the source for FreeRTOS systick.
@@ -283,7 +306,12 @@ BaseType_t xPortStartScheduler( void )
      */
     portDISABLE_INTERRUPTS();
 
-    port_xSchedulerRunning[ xPortGetCoreID() ] = 1;
+    /* In SMP builds _frxt_dispatch sets port_xSchedulerRunning instead, once
+     * this core is running on a task stack, so the other core can tell when
+     * this core's startup stack is no longer in use. */
+    #if ( configNUMBER_OF_CORES == 1 )
+        port_xSchedulerRunning[ xPortGetCoreID() ] = 1;
+    #endif
 
     /* Cannot be directly called from C; never returns */
     __asm__ volatile ( "call0    _frxt_dispatch\n" );
@@ -383,6 +411,50 @@ void IRAM_ATTR vPortEvaluateYieldFromISR( int argc,
     }
 }
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void IRAM_ATTR vPortEnterCriticalISR( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xCoreID;
+
+        uxSavedInterruptStatus = vTaskEnterCriticalFromISR();
+
+        /* Interrupts are now masked so the core cannot change. */
+        xCoreID = xPortGetCoreID();
+
+        if( port_uxISRCriticalNesting[ xCoreID ] == 0U )
+        {
+            port_uxISRSavedInterruptStatus[ xCoreID ] = uxSavedInterruptStatus;
+        }
+
+        port_uxISRCriticalNesting[ xCoreID ]++;
+    }
+
+    void IRAM_ATTR vPortExitCriticalISR( void )
+    {
+        UBaseType_t uxInterruptStatus;
+        BaseType_t xCoreID = xPortGetCoreID();
+
+        configASSERT( port_uxISRCriticalNesting[ xCoreID ] > 0U );
+
+        port_uxISRCriticalNesting[ xCoreID ]--;
+
+        if( port_uxISRCriticalNesting[ xCoreID ] == 0U )
+        {
+            uxInterruptStatus = port_uxISRSavedInterruptStatus[ xCoreID ];
+        }
+        else
+        {
+            /* Still nested, so leave interrupts masked at the current level. */
+            RSR( PS, uxInterruptStatus );
+        }
+
+        vTaskExitCriticalFromISR( uxInterruptStatus );
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 void vPortAssertIfInISR()
 {
     if( xPortInIsrContext() )
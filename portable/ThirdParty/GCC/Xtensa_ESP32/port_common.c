@@ -82,7 +82,7 @@ void esp_startup_start_app_common( void )
     ( void ) res;
 }
 
-#if !CONFIG_FREERTOS_UNICORE
+#if !CONFIG_FREERTOS_UNICORE && ( configNUMBER_OF_CORES == 1 )
     static volatile bool s_other_cpu_startup_done = false;
     static bool other_cpu_startup_idle_hook_cb( void )
     {
@@ -91,17 +91,60 @@ void esp_startup_start_app_common( void )
     }
 #endif
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/*
+ * Called by the ESP-IDF startup code on the APP CPU. With the native SMP
+ * kernel the scheduler is started once, on the PRO CPU, so the APP CPU waits
+ * for that and then joins the running scheduler.
+ */
+    void esp_startup_start_app_other_cores( void )
+    {
+        /* Only cores 0 and 1 are supported. */
+        if( xPortGetCoreID() >= portNUM_PROCESSORS )
+        {
+            abort();
+        }
+
+        /* Wait for the scheduler to start on the PRO CPU. */
+        while( port_xSchedulerRunning[ 0 ] == 0 )
+        {
+        }
+
+        #if CONFIG_ESP_INT_WDT
+            /*Initialize the interrupt watch dog for CPU1. */
+            esp_int_wdt_cpu_init();
+        #endif
+
+        esp_crosscore_int_init();
+
+        ESP_EARLY_LOGI( "cpu_start", "Starting scheduler on APP CPU." );
+        ( void ) xPortStartScheduler();
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 static void main_task( void * args )
 {
     #if !CONFIG_FREERTOS_UNICORE
-        /* Wait for FreeRTOS initialization to finish on other core, before replacing its startup stack */
-        esp_register_freertos_idle_hook_for_cpu( other_cpu_startup_idle_hook_cb, !xPortGetCoreID() );
+        #if ( configNUMBER_OF_CORES > 1 )
 
-        while( !s_other_cpu_startup_done )
-        {
-        }
-        esp_deregister_freertos_idle_hook_for_cpu( other_cpu_startup_idle_hook_cb, !xPortGetCoreID() );
-    #endif
+            /* The SMP kernel does not tie an idle task to a core, so wait for
+             * the other core to be dispatched onto a task stack instead, before
+             * replacing its startup stack. */
+            while( port_xSchedulerRunning[ !xPortGetCoreID() ] == 0 )
+            {
+            }
+        #else
+            /* Wait for FreeRTOS initialization to finish on other core, before replacing its startup stack */
+            esp_register_freertos_idle_hook_for_cpu( other_cpu_startup_idle_hook_cb, !xPortGetCoreID() );
+
+            while( !s_other_cpu_startup_done )
+            {
+            }
+            esp_deregister_freertos_idle_hook_for_cpu( other_cpu_startup_idle_hook_cb, !xPortGetCoreID() );
+        #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+    #endif /* if !CONFIG_FREERTOS_UNICORE */
 
     /* [refactor-todo] check if there is a way to move the following block to esp_system startup */
     heap_caps_enable_nonos_stack_heaps();
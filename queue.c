@@ -77,6 +77,45 @@ typedef struct SemaphoreData
     UBaseType_t uxRecursiveCallCount; /**< Maintains a count of the number of times a recursive mutex has been recursively 'taken' when the structure is used as a mutex. */
 } SemaphoreData_t;
 
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+/* Marks the end of a list of storage slots in a priority queue. */
+    #define queuePRIORITY_NO_SLOT          ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+
+/* The number of priorities recorded in each word of the ready priority bitmap,
+ * and the number of words needed to record uxNumberOfPriorities priorities. */
+    #define queuePRIORITY_BITS_PER_WORD    ( ( UBaseType_t ) ( sizeof( UBaseType_t ) * ( size_t ) 8U ) )
+    #define queuePRIORITY_BITMAP_WORDS( uxNumberOfPriorities )    ( ( ( uxNumberOfPriorities ) + ( queuePRIORITY_BITS_PER_WORD - ( UBaseType_t ) 1U ) ) / queuePRIORITY_BITS_PER_WORD )
+
+/* Holds the state of a queue created by xQueueCreatePriority().  Each slot in
+ * the queue storage area is on exactly one singly linked list - either the list
+ * of free slots, or the list of messages of the priority held in the slot.  The
+ * lists are linked through puxNextSlot[], and a bit is set in
+ * puxReadyPriorities[] for each priority that has at least one message, so the
+ * highest priority message is found by scanning one bitmap word per
+ * queuePRIORITY_BITS_PER_WORD priorities rather than one list per priority.
+ * Messages of equal priority are received in the order they were sent. */
+    typedef struct PriorityQueueData
+    {
+        UBaseType_t uxNumberOfPriorities; /**< Messages can have priorities from 0 to ( uxNumberOfPriorities - 1 ). */
+        UBaseType_t uxTopPriority;        /**< The priority of the message most recently copied out of the queue, which is the next to be removed. */
+        UBaseType_t uxFreeSlot;           /**< The first slot on the list of free slots. */
+        UBaseType_t * puxNextSlot;        /**< uxLength entries, each holding the slot that follows the slot of the same index on its list. */
+        UBaseType_t * puxFirstSlot;       /**< uxNumberOfPriorities entries, each holding the slot of the oldest message of that priority. */
+        UBaseType_t * puxLastSlot;        /**< uxNumberOfPriorities entries, each holding the slot of the newest message of that priority. */
+        UBaseType_t * puxReadyPriorities; /**< queuePRIORITY_BITMAP_WORDS( uxNumberOfPriorities ) entries, with bit ( n % queuePRIORITY_BITS_PER_WORD ) of entry ( n / queuePRIORITY_BITS_PER_WORD ) set if priority n has a message. */
+    } PriorityQueueData_t;
+
+#endif /* configUSE_PRIORITY_QUEUES */
+
+/* Only a priority queue accepts the copy positions of queueSEND_WITH_PRIORITY().
+ * Any other queue would treat them as queueSEND_TO_FRONT. */
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+    #define queueIS_VALID_COPY_POSITION( pxQueue, xCopyPosition )    ( ( ( pxQueue )->pxPriorityData != NULL ) || ( ( xCopyPosition ) <= queueOVERWRITE ) )
+#else
+    #define queueIS_VALID_COPY_POSITION( pxQueue, xCopyPosition )    ( ( xCopyPosition ) <= queueOVERWRITE )
+#endif
+
 /* Semaphores do not actually store or copy data, so have an item size of
  * zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH    ( ( UBaseType_t ) 0 )
@@ -129,6 +168,10 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         struct QueueDefinition * pxQueueSetContainer;
     #endif
 
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        PriorityQueueData_t * pxPriorityData; /**< Points to the message lists of a queue created by xQueueCreatePriority(), otherwise NULL. */
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
@@ -210,6 +253,60 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Macro used to copy every item into and out of a queue's storage area.  The
+ * default, prvCopyItem(), gives the compiler a fixed size copy for the small
+ * item sizes that are typical of queues.  It can be overridden in
+ * FreeRTOSConfig.h, for example to use a vectorised copy routine for queues that
+ * hold large items.
+ */
+#ifndef queueCOPY_ITEM
+    #define queueCOPY_ITEM( pvDestination, pvSource, uxItemSize )    prvCopyItem( ( pvDestination ), ( pvSource ), ( uxItemSize ) )
+    #define queueUSE_DEFAULT_COPY_ITEM                               1
+#else
+    #define queueUSE_DEFAULT_COPY_ITEM                               0
+#endif
+
+#if ( queueUSE_DEFAULT_COPY_ITEM == 1 )
+
+/*
+ * Copies a single item of uxItemSize bytes between a queue's storage area and
+ * a caller's buffer.
+ */
+    static void prvCopyItem( void * pvDestination,
+                             const void * pvSource,
+                             UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+/*
+ * Place every slot of a priority queue on the free list.
+ */
+    static void prvResetPriorityQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy an item into a free slot of a priority queue and append the slot to the
+ * list of messages of the item's priority.
+ */
+    static void prvCopyDataToPriorityQueue( Queue_t * const pxQueue,
+                                            const void * pvItemToQueue,
+                                            const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy the oldest of the highest priority messages out of a priority queue
+ * without removing it.
+ */
+    static void prvCopyDataFromPriorityQueue( Queue_t * const pxQueue,
+                                              void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove the message last copied by prvCopyDataFromPriorityQueue(), returning
+ * its slot to the free list.
+ */
+    static void prvRemoveFromPriorityQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -324,6 +421,19 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_PRIORITY_QUEUES == 1 )
+            {
+                if( pxQueue->pxPriorityData != NULL )
+                {
+                    prvResetPriorityQueue( pxQueue );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_PRIORITY_QUEUES */
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -566,6 +676,105 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreatePriority( const UBaseType_t uxQueueLength,
+                                        const UBaseType_t uxItemSize,
+                                        const UBaseType_t uxNumberOfPriorities )
+    {
+        Queue_t * pxNewQueue = NULL;
+        PriorityQueueData_t * pxPriorityData;
+        size_t xQueueSizeInBytes, xIndexSizeInBytes;
+        uint8_t * pucQueueStorage;
+
+        /* The largest number of slot indexes that can be allocated along with
+         * the queue and priority structures.  The bitmap never needs more words
+         * than there are priorities. */
+        const size_t xMaxIndexes = ( SIZE_MAX - sizeof( Queue_t ) - sizeof( PriorityQueueData_t ) ) / ( 4U * sizeof( UBaseType_t ) );
+
+        traceENTER_xQueueCreatePriority( uxQueueLength, uxItemSize, uxNumberOfPriorities );
+
+        if( ( uxQueueLength > ( UBaseType_t ) 0 ) &&
+            ( uxItemSize > ( UBaseType_t ) 0 ) &&
+            ( uxNumberOfPriorities > ( UBaseType_t ) 0 ) &&
+            /* Check the slot and priority indexes cannot overflow. */
+            ( ( size_t ) uxQueueLength <= xMaxIndexes ) &&
+            ( ( size_t ) uxNumberOfPriorities <= xMaxIndexes ) &&
+            /* Check for multiplication overflow. */
+            ( ( SIZE_MAX / uxQueueLength ) >= uxItemSize ) )
+        {
+            xIndexSizeInBytes = ( ( size_t ) uxQueueLength + ( 2U * ( size_t ) uxNumberOfPriorities ) + ( size_t ) queuePRIORITY_BITMAP_WORDS( uxNumberOfPriorities ) ) * sizeof( UBaseType_t );
+            xQueueSizeInBytes = ( size_t ) ( ( size_t ) uxQueueLength * ( size_t ) uxItemSize );
+
+            /* Check for addition overflow. */
+            if( ( SIZE_MAX - sizeof( Queue_t ) - sizeof( PriorityQueueData_t ) - xIndexSizeInBytes ) >= xQueueSizeInBytes )
+            {
+                /* The queue structure, the priority structure, the slot and
+                 * priority indexes, the ready priority bitmap and the queue
+                 * storage area are allocated in
+                 * that order in a single block.  The storage area comes last as
+                 * the item size may leave it unaligned. */
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + sizeof( PriorityQueueData_t ) + xIndexSizeInBytes + xQueueSizeInBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxNewQueue != NULL )
+            {
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxPriorityData = ( PriorityQueueData_t * ) &( pxNewQueue[ 1 ] );
+                pxPriorityData->uxNumberOfPriorities = uxNumberOfPriorities;
+                pxPriorityData->puxNextSlot = ( UBaseType_t * ) &( pxPriorityData[ 1 ] );
+                pxPriorityData->puxFirstSlot = &( pxPriorityData->puxNextSlot[ uxQueueLength ] );
+                pxPriorityData->puxLastSlot = &( pxPriorityData->puxFirstSlot[ uxNumberOfPriorities ] );
+
+                pxPriorityData->puxReadyPriorities = &( pxPriorityData->puxLastSlot[ uxNumberOfPriorities ] );
+
+                pucQueueStorage = ( uint8_t * ) &( pxPriorityData->puxReadyPriorities[ queuePRIORITY_BITMAP_WORDS( uxNumberOfPriorities ) ] );
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* Queues can be created either statically or dynamically, so
+                     * note this queue was created dynamically in case it is later
+                     * deleted. */
+                    pxNewQueue->ucStaticallyAllocated = pdFALSE;
+                }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+                prvInitialiseNewQueue( uxQueueLength, uxItemSize, pucQueueStorage, queueQUEUE_TYPE_PRIORITY, pxNewQueue );
+
+                /* prvInitialiseNewQueue() set the queue up as a FIFO queue, now
+                 * attach and initialise the per priority message lists. */
+                pxNewQueue->pxPriorityData = pxPriorityData;
+                prvResetPriorityQueue( pxNewQueue );
+            }
+            else
+            {
+                traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_PRIORITY );
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            configASSERT( pxNewQueue );
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueCreatePriority( pxNewQueue );
+
+        return pxNewQueue;
+    }
+
+#endif /* ( configUSE_PRIORITY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
 static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
                                    const UBaseType_t uxItemSize,
                                    uint8_t * pucQueueStorage,
@@ -594,6 +803,13 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
      * defined. */
     pxNewQueue->uxLength = uxQueueLength;
     pxNewQueue->uxItemSize = uxItemSize;
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+    {
+        pxNewQueue->pxPriorityData = NULL;
+    }
+    #endif /* configUSE_PRIORITY_QUEUES */
+
     ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -960,6 +1176,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     configASSERT( pxQueue );
     configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
     configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+    configASSERT( queueIS_VALID_COPY_POSITION( pxQueue, xCopyPosition ) );
     #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
     {
         configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
@@ -1178,6 +1395,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     configASSERT( pxQueue );
     configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
     configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+    configASSERT( queueIS_VALID_COPY_POSITION( pxQueue, xCopyPosition ) );
 
     /* RTOS ports that support interrupt nesting have the concept of a maximum
      * system call (or maximum API call) interrupt priority.  Interrupts that are
@@ -1545,6 +1763,20 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
             {
                 /* Data available, remove one item. */
                 prvCopyDataFromQueue( pxQueue, pvBuffer );
+
+                #if ( configUSE_PRIORITY_QUEUES == 1 )
+                {
+                    if( pxQueue->pxPriorityData != NULL )
+                    {
+                        prvRemoveFromPriorityQueue( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_PRIORITY_QUEUES */
+
                 traceQUEUE_RECEIVE( pxQueue );
                 pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
 
@@ -1798,6 +2030,12 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                             xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
                         }
                         taskEXIT_CRITICAL();
+
+                        #if ( configUSE_DEADLOCK_DETECTION == 1 )
+                        {
+                            vTaskSetBlockingMutex( pxQueue, &( pxQueue->u.xSemaphore.xMutexHolder ) );
+                        }
+                        #endif
                     }
                     else
                     {
@@ -1817,6 +2055,14 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+
+                #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_DEADLOCK_DETECTION == 1 ) )
+                {
+                    /* The task is no longer blocked on the mutex, if it was
+                     * blocked on a mutex. */
+                    vTaskSetBlockingMutex( NULL, NULL );
+                }
+                #endif
             }
             else
             {
@@ -2042,6 +2288,271 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
+BaseType_t xQueuePeekInPlace( QueueHandle_t xQueue,
+                              void ** const ppvItems,
+                              UBaseType_t * const puxItemsAvailable,
+                              TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+    int8_t * pcNextItem;
+    UBaseType_t uxContiguousItems;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_xQueuePeekInPlace( xQueue, ppvItems, puxItemsAvailable, xTicksToWait );
+
+    /* Check the pointer is not NULL. */
+    configASSERT( ( pxQueue ) );
+
+    configASSERT( ppvItems );
+    configASSERT( puxItemsAvailable );
+
+    /* Semaphores hold no data so there is nothing to point to. */
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    /* The messages in a priority queue are not stored in the order they are
+     * received. */
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+    {
+        configASSERT( pxQueue->pxPriorityData == NULL );
+    }
+    #endif
+
+    /* Cannot block if the scheduler is suspended. */
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    for( ; ; )
+    {
+        taskENTER_CRITICAL();
+        {
+            const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+            /* Is there data in the queue now?  To be running the calling task
+             * must be the highest priority task wanting to access the queue. */
+            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            {
+                /* pcReadFrom points to the item that was read last, so the
+                 * next item is the one after it - the same calculation as
+                 * prvCopyDataFromQueue() but without moving pcReadFrom. */
+                pcNextItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+
+                if( pcNextItem >= pxQueue->u.xQueue.pcTail )
+                {
+                    pcNextItem = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Only report the items that are contiguous in the storage
+                 * area.  Any that follow the wrap are returned by the next call
+                 * once these have been released. */
+                uxContiguousItems = ( UBaseType_t ) ( ( size_t ) ( pxQueue->u.xQueue.pcTail - pcNextItem ) / ( size_t ) pxQueue->uxItemSize );
+
+                if( uxContiguousItems > uxMessagesWaiting )
+                {
+                    uxContiguousItems = uxMessagesWaiting;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                *ppvItems = ( void * ) pcNextItem;
+                *puxItemsAvailable = uxContiguousItems;
+                traceQUEUE_PEEK( pxQueue );
+
+                /* The data is being left in the queue, so see if there are
+                 * any other tasks waiting for the data. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        /* The task waiting has a higher priority than this task. */
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                taskEXIT_CRITICAL();
+
+                traceRETURN_xQueuePeekInPlace( pdPASS );
+
+                return pdPASS;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was empty and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    taskEXIT_CRITICAL();
+
+                    traceQUEUE_PEEK_FAILED( pxQueue );
+                    traceRETURN_xQueuePeekInPlace( errQUEUE_EMPTY );
+
+                    return errQUEUE_EMPTY;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The queue was empty and a block time was specified so
+                     * configure the timeout structure ready to enter the blocked
+                     * state. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Interrupts and other tasks can send to and receive from the queue
+         * now that the critical section has been exited. */
+
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            /* Timeout has not expired yet, check to see if there is data in the
+            * queue now, and if not enter the Blocked state to wait for data. */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* There is data in the queue now, so don't enter the blocked
+                 * state, instead return to try and obtain the data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* The timeout has expired.  If there is still no data in the queue
+             * exit, otherwise go back and try to read the data again. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceQUEUE_PEEK_FAILED( pxQueue );
+                traceRETURN_xQueuePeekInPlace( errQUEUE_EMPTY );
+
+                return errQUEUE_EMPTY;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReleaseInPlace( QueueHandle_t xQueue,
+                                 UBaseType_t uxItemsToRelease )
+{
+    BaseType_t xReturn;
+    UBaseType_t uxItem;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_xQueueReleaseInPlace( xQueue, uxItemsToRelease );
+
+    configASSERT( pxQueue );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+    {
+        configASSERT( pxQueue->pxPriorityData == NULL );
+    }
+    #endif
+
+    taskENTER_CRITICAL();
+    {
+        if( ( uxItemsToRelease > ( UBaseType_t ) 0 ) && ( uxItemsToRelease <= pxQueue->uxMessagesWaiting ) )
+        {
+            /* Move the read position over the released items exactly as if they
+             * had been received one at a time. */
+            for( uxItem = ( UBaseType_t ) 0; uxItem < uxItemsToRelease; uxItem++ )
+            {
+                pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                traceQUEUE_RECEIVE( pxQueue );
+                pxQueue->uxMessagesWaiting--;
+
+                /* Each released item frees one space, so unblock one waiting
+                 * sender per item. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    traceRETURN_xQueueReleaseInPlace( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                                  void * const pvBuffer,
                                  BaseType_t * const pxHigherPriorityTaskWoken )
@@ -2086,6 +2597,20 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
             traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
 
             prvCopyDataFromQueue( pxQueue, pvBuffer );
+
+            #if ( configUSE_PRIORITY_QUEUES == 1 )
+            {
+                if( pxQueue->pxPriorityData != NULL )
+                {
+                    prvRemoveFromPriorityQueue( pxQueue );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_PRIORITY_QUEUES */
+
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
 
             /* If the queue is locked the event list will not be modified.
@@ -2425,9 +2950,16 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
         }
         #endif /* configUSE_MUTEXES */
     }
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        else if( pxQueue->pxPriorityData != NULL )
+        {
+            prvCopyDataToPriorityQueue( pxQueue, pvItemToQueue, xPosition );
+        }
+    #endif /* configUSE_PRIORITY_QUEUES */
     else if( xPosition == queueSEND_TO_BACK )
     {
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, pxQueue->uxItemSize );
         pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
         if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
@@ -2441,7 +2973,7 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
     else
     {
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, pxQueue->uxItemSize );
         pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
 
         if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
@@ -2483,6 +3015,13 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer )
 {
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        if( pxQueue->pxPriorityData != NULL )
+        {
+            prvCopyDataFromPriorityQueue( pxQueue, pvBuffer );
+        }
+        else
+    #endif /* configUSE_PRIORITY_QUEUES */
     if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
     {
         pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
@@ -2496,11 +3035,215 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
             mtCOVERAGE_TEST_MARKER();
         }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+        queueCOPY_ITEM( pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, pxQueue->uxItemSize );
     }
 }
 /*-----------------------------------------------------------*/
 
+#if ( queueUSE_DEFAULT_COPY_ITEM == 1 )
+
+    static void prvCopyItem( void * pvDestination,
+                             const void * pvSource,
+                             UBaseType_t uxItemSize )
+    {
+        /* Queue items are usually a pointer, an integer or a small structure.  A
+         * memcpy() with a constant length is expanded inline by the compiler into
+         * one or two word sized loads and stores that respect the alignment of
+         * both buffers, which avoids the call and the size and alignment checks
+         * performed by a general purpose memcpy(). */
+        switch( uxItemSize )
+        {
+            case 1U:
+                ( void ) memcpy( pvDestination, pvSource, 1U );
+                break;
+
+            case 2U:
+                ( void ) memcpy( pvDestination, pvSource, 2U );
+                break;
+
+            case 4U:
+                ( void ) memcpy( pvDestination, pvSource, 4U );
+                break;
+
+            case 8U:
+                ( void ) memcpy( pvDestination, pvSource, 8U );
+                break;
+
+            case 16U:
+                ( void ) memcpy( pvDestination, pvSource, 16U );
+                break;
+
+            default:
+                ( void ) memcpy( pvDestination, pvSource, ( size_t ) uxItemSize );
+                break;
+        }
+    }
+
+#endif /* queueUSE_DEFAULT_COPY_ITEM */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+    static void prvResetPriorityQueue( Queue_t * const pxQueue )
+    {
+        PriorityQueueData_t * const pxPriorityData = pxQueue->pxPriorityData;
+        UBaseType_t uxIndex;
+
+        for( uxIndex = ( UBaseType_t ) 0; uxIndex < pxQueue->uxLength; uxIndex++ )
+        {
+            pxPriorityData->puxNextSlot[ uxIndex ] = uxIndex + ( UBaseType_t ) 1;
+        }
+
+        pxPriorityData->puxNextSlot[ pxQueue->uxLength - ( UBaseType_t ) 1 ] = queuePRIORITY_NO_SLOT;
+        pxPriorityData->uxFreeSlot = ( UBaseType_t ) 0;
+
+        for( uxIndex = ( UBaseType_t ) 0; uxIndex < pxPriorityData->uxNumberOfPriorities; uxIndex++ )
+        {
+            pxPriorityData->puxFirstSlot[ uxIndex ] = queuePRIORITY_NO_SLOT;
+            pxPriorityData->puxLastSlot[ uxIndex ] = queuePRIORITY_NO_SLOT;
+        }
+
+        for( uxIndex = ( UBaseType_t ) 0; uxIndex < queuePRIORITY_BITMAP_WORDS( pxPriorityData->uxNumberOfPriorities ); uxIndex++ )
+        {
+            pxPriorityData->puxReadyPriorities[ uxIndex ] = ( UBaseType_t ) 0;
+        }
+
+        pxPriorityData->uxTopPriority = ( UBaseType_t ) 0;
+    }
+
+#endif /* configUSE_PRIORITY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+    static void prvCopyDataToPriorityQueue( Queue_t * const pxQueue,
+                                            const void * pvItemToQueue,
+                                            const BaseType_t xPosition )
+    {
+        PriorityQueueData_t * const pxPriorityData = pxQueue->pxPriorityData;
+        UBaseType_t uxPriority, uxSlot;
+
+        /* Items posted with xQueueSend() or xQueueSendToBack() have the lowest
+         * priority.  Priority queues cannot be posted to the front of, or
+         * overwritten. */
+        configASSERT( ( xPosition == queueSEND_TO_BACK ) || ( xPosition >= queueSEND_WITH_PRIORITY( 0 ) ) );
+
+        if( xPosition >= queueSEND_WITH_PRIORITY( 0 ) )
+        {
+            uxPriority = ( UBaseType_t ) ( xPosition - queueSEND_WITH_PRIORITY( 0 ) );
+        }
+        else
+        {
+            uxPriority = ( UBaseType_t ) 0;
+        }
+
+        configASSERT( uxPriority < pxPriorityData->uxNumberOfPriorities );
+
+        /* The caller has already checked there is space in the queue, so
+         * there is a free slot. */
+        uxSlot = pxPriorityData->uxFreeSlot;
+        configASSERT( uxSlot != queuePRIORITY_NO_SLOT );
+        pxPriorityData->uxFreeSlot = pxPriorityData->puxNextSlot[ uxSlot ];
+
+        queueCOPY_ITEM( ( void * ) &( pxQueue->pcHead[ uxSlot * pxQueue->uxItemSize ] ), pvItemToQueue, pxQueue->uxItemSize );
+
+        /* Append the slot to the list of its priority so messages of equal
+         * priority are received in the order they were sent. */
+        pxPriorityData->puxNextSlot[ uxSlot ] = queuePRIORITY_NO_SLOT;
+
+        if( pxPriorityData->puxLastSlot[ uxPriority ] == queuePRIORITY_NO_SLOT )
+        {
+            pxPriorityData->puxFirstSlot[ uxPriority ] = uxSlot;
+            pxPriorityData->puxReadyPriorities[ uxPriority / queuePRIORITY_BITS_PER_WORD ] |= ( ( UBaseType_t ) 1U ) << ( uxPriority % queuePRIORITY_BITS_PER_WORD );
+        }
+        else
+        {
+            pxPriorityData->puxNextSlot[ pxPriorityData->puxLastSlot[ uxPriority ] ] = uxSlot;
+        }
+
+        pxPriorityData->puxLastSlot[ uxPriority ] = uxSlot;
+    }
+
+#endif /* configUSE_PRIORITY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+    static void prvCopyDataFromPriorityQueue( Queue_t * const pxQueue,
+                                              void * const pvBuffer )
+    {
+        PriorityQueueData_t * const pxPriorityData = pxQueue->pxPriorityData;
+        UBaseType_t uxWord = queuePRIORITY_BITMAP_WORDS( pxPriorityData->uxNumberOfPriorities ) - ( UBaseType_t ) 1U;
+        UBaseType_t uxReadyPriorities, uxTopPriority, uxShift;
+
+        /* The caller has already checked the queue is not empty.  Find the
+         * highest bitmap word that has a priority with a message.  There is
+         * only one word unless there are more than queuePRIORITY_BITS_PER_WORD
+         * priorities. */
+        while( pxPriorityData->puxReadyPriorities[ uxWord ] == ( UBaseType_t ) 0U )
+        {
+            configASSERT( uxWord );
+            --uxWord;
+        }
+
+        /* Find the highest set bit in the word by halving the search width,
+         * which takes log2( queuePRIORITY_BITS_PER_WORD ) steps whatever the
+         * bits are, as a count leading zeros instruction would in
+         * portGET_HIGHEST_PRIORITY(). */
+        uxReadyPriorities = pxPriorityData->puxReadyPriorities[ uxWord ];
+        uxTopPriority = uxWord * queuePRIORITY_BITS_PER_WORD;
+
+        for( uxShift = queuePRIORITY_BITS_PER_WORD / ( UBaseType_t ) 2U; uxShift > ( UBaseType_t ) 0U; uxShift /= ( UBaseType_t ) 2U )
+        {
+            if( ( uxReadyPriorities >> uxShift ) != ( UBaseType_t ) 0U )
+            {
+                uxReadyPriorities >>= uxShift;
+                uxTopPriority += uxShift;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Record the priority so the message can be removed without searching
+         * again. */
+        pxPriorityData->uxTopPriority = uxTopPriority;
+
+        queueCOPY_ITEM( pvBuffer, ( void * ) &( pxQueue->pcHead[ pxPriorityData->puxFirstSlot[ uxTopPriority ] * pxQueue->uxItemSize ] ), pxQueue->uxItemSize );
+    }
+
+#endif /* configUSE_PRIORITY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+    static void prvRemoveFromPriorityQueue( Queue_t * const pxQueue )
+    {
+        PriorityQueueData_t * const pxPriorityData = pxQueue->pxPriorityData;
+        const UBaseType_t uxTopPriority = pxPriorityData->uxTopPriority;
+        const UBaseType_t uxSlot = pxPriorityData->puxFirstSlot[ uxTopPriority ];
+
+        pxPriorityData->puxFirstSlot[ uxTopPriority ] = pxPriorityData->puxNextSlot[ uxSlot ];
+
+        if( pxPriorityData->puxFirstSlot[ uxTopPriority ] == queuePRIORITY_NO_SLOT )
+        {
+            pxPriorityData->puxLastSlot[ uxTopPriority ] = queuePRIORITY_NO_SLOT;
+            pxPriorityData->puxReadyPriorities[ uxTopPriority / queuePRIORITY_BITS_PER_WORD ] &= ~( ( ( UBaseType_t ) 1U ) << ( uxTopPriority % queuePRIORITY_BITS_PER_WORD ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Return the slot to the free list. */
+        pxPriorityData->puxNextSlot[ uxSlot ] = pxPriorityData->uxFreeSlot;
+        pxPriorityData->uxFreeSlot = uxSlot;
+    }
+
+#endif /* configUSE_PRIORITY_QUEUES */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -2839,20 +3582,24 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         {
             if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
             {
-                /* Data is available from the queue. */
-                pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+                /* Data is available from the queue.  Messages in a priority
+                 * queue are received highest priority first, as from a task. */
+                prvCopyDataFromQueue( pxQueue, pvBuffer );
 
-                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+                #if ( configUSE_PRIORITY_QUEUES == 1 )
                 {
-                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
+                    if( pxQueue->pxPriorityData != NULL )
+                    {
+                        prvRemoveFromPriorityQueue( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
+                #endif /* configUSE_PRIORITY_QUEUES */
 
                 --( pxQueue->uxMessagesWaiting );
-                ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
 
                 xReturn = pdPASS;
 
@@ -2962,19 +3709,22 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
         {
             /* Copy the data from the queue. */
-            pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
 
-            if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
-            {
-                pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
-            }
-            else
+            #if ( configUSE_PRIORITY_QUEUES == 1 )
             {
-                mtCOVERAGE_TEST_MARKER();
+                if( pxQueue->pxPriorityData != NULL )
+                {
+                    prvRemoveFromPriorityQueue( pxQueue );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
+            #endif /* configUSE_PRIORITY_QUEUES */
 
             --( pxQueue->uxMessagesWaiting );
-            ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
 
             if( ( *pxCoRoutineWoken ) == pdFALSE )
             {
@@ -3137,6 +3887,33 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* configQUEUE_REGISTRY_SIZE */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) )
+
+    void vQueueWriteSnapshot( SnapshotWriter_t * pxWriter )
+    {
+        UBaseType_t ux;
+
+        /* Queues are not otherwise reachable from kernel variables, so only the
+         * queues in the registry can be included.  No critical section is used
+         * as this may be called from a fault handler. */
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, xQueueRegistry, sizeof( xQueueRegistry ) );
+
+        for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+        {
+            if( xQueueRegistry[ ux ].xHandle != NULL )
+            {
+                vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_QUEUE, xQueueRegistry[ ux ].xHandle, sizeof( Queue_t ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TIMERS == 1 )
 
     void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
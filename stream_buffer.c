@@ -218,8 +218,27 @@
     sbSEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
     #endif /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
 
+/* The number of bytes of the length field written at the start of each message. */
+    #define sbMESSAGE_LENGTH_FIELD_BYTES    ( sizeof( configMESSAGE_BUFFER_LENGTH_TYPE ) )
+
+/* Rounds a number of bytes up to a whole number of configMESSAGE_BUFFER_ALIGNMENT
+ * units.  Each message buffer record (the length field and the message that
+ * follows it) is padded to this granularity so every record, and therefore
+ * every message, starts at an aligned offset within the buffer.  Reduces to a
+ * no-op when configMESSAGE_BUFFER_ALIGNMENT is left at its default of 1. */
+    #define sbALIGN_MESSAGE_BYTES( xBytes )                                     \
+    ( ( ( size_t ) ( xBytes ) + ( ( size_t ) configMESSAGE_BUFFER_ALIGNMENT - 1U ) ) & \
+      ~( ( size_t ) configMESSAGE_BUFFER_ALIGNMENT - 1U ) )
+
 /* The number of bytes used to hold the length of a message in the buffer. */
-    #define sbBYTES_TO_STORE_MESSAGE_LENGTH    ( sizeof( configMESSAGE_BUFFER_LENGTH_TYPE ) )
+    #define sbBYTES_TO_STORE_MESSAGE_LENGTH    sbALIGN_MESSAGE_BYTES( sbMESSAGE_LENGTH_FIELD_BYTES )
+
+/* Macro used to copy data into and out of a stream buffer's storage area.  It
+ * can be overridden in FreeRTOSConfig.h, for example to use a vectorised copy
+ * routine for buffers that carry large blocks of data. */
+    #ifndef sbCOPY_BYTES
+        #define sbCOPY_BYTES( pvDestination, pvSource, xBytes )    ( void ) memcpy( ( pvDestination ), ( pvSource ), ( xBytes ) )
+    #endif
 
 /* Bits stored in the ucFlags field of the stream buffer. */
     #define sbFLAGS_IS_MESSAGE_BUFFER          ( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
@@ -314,6 +333,31 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       size_t xCount,
                                       size_t xTail ) PRIVILEGED_FUNCTION;
 
+/*
+ * Write or read the length field at the start of a message buffer record, then
+ * move the index on to the first byte of the message itself.  When the field
+ * does not wrap around the end of the buffer, which is almost always the case,
+ * it is copied with a fixed size memcpy() the compiler can expand inline.
+ */
+static size_t prvWriteMessageLengthToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                             configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength,
+                                             size_t xHead ) PRIVILEGED_FUNCTION;
+static size_t prvReadMessageLengthFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                              configMESSAGE_BUFFER_LENGTH_TYPE * pxMessageLength,
+                                              size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves xIndex over the padding that follows xUsedBytes of a message buffer
+ * record, so the index lands on the next configMESSAGE_BUFFER_ALIGNMENT
+ * boundary.  As the buffer length is a whole number of alignment units the
+ * padding never straddles the end of the buffer.
+ */
+    #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+        static size_t prvSkipMessagePadding( const StreamBuffer_t * const pxStreamBuffer,
+                                             size_t xIndex,
+                                             size_t xUsedBytes ) PRIVILEGED_FUNCTION;
+    #endif
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -335,6 +379,8 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                                      StreamBufferCallbackFunction_t pxReceiveCompletedCallback )
     {
         void * pvAllocatedMemory;
+        uint8_t * pucStorageArea;
+        size_t xStorageAlignmentBytes = 0;
         uint8_t ucFlags;
 
         traceENTER_xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pxSendCompletedCallback, pxReceiveCompletedCallback );
@@ -371,6 +417,27 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             xTriggerLevelBytes = ( size_t ) 1;
         }
 
+        #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+        {
+            if( ( ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                /* Every record in an aligned message buffer occupies whole
+                 * alignment units, so the storage area must be a whole number
+                 * of units long and start on an aligned address.  Round the
+                 * size up to whole units, less the one byte added below, and
+                 * over allocate so the start of the storage area can be
+                 * aligned. */
+                configASSERT( sbALIGN_MESSAGE_BYTES( xBufferSizeBytes ) >= xBufferSizeBytes );
+                xBufferSizeBytes = sbALIGN_MESSAGE_BYTES( xBufferSizeBytes ) + ( ( size_t ) configMESSAGE_BUFFER_ALIGNMENT - 1U );
+                xStorageAlignmentBytes = ( size_t ) configMESSAGE_BUFFER_ALIGNMENT - 1U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configMESSAGE_BUFFER_ALIGNMENT */
+
         /* A stream buffer requires a StreamBuffer_t structure and a buffer.
          * Both are allocated in a single call to pvPortMalloc().  The
          * StreamBuffer_t structure is placed at the start of the allocated memory
@@ -379,10 +446,10 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
          * this is a quirk of the implementation that means otherwise the free
          * space would be reported as one byte smaller than would be logically
          * expected. */
-        if( xBufferSizeBytes < ( xBufferSizeBytes + 1U + sizeof( StreamBuffer_t ) ) )
+        if( xBufferSizeBytes < ( xBufferSizeBytes + 1U + sizeof( StreamBuffer_t ) + xStorageAlignmentBytes ) )
         {
             xBufferSizeBytes++;
-            pvAllocatedMemory = pvPortMalloc( xBufferSizeBytes + sizeof( StreamBuffer_t ) );
+            pvAllocatedMemory = pvPortMalloc( xBufferSizeBytes + sizeof( StreamBuffer_t ) + xStorageAlignmentBytes );
         }
         else
         {
@@ -391,14 +458,25 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 
         if( pvAllocatedMemory != NULL )
         {
+            /* The storage area follows the structure, moved up to the next
+             * aligned address if this is an aligned message buffer. */
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pucStorageArea = ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t );
+
+            #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+            {
+                pucStorageArea = ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pucStorageArea + ( portPOINTER_SIZE_TYPE ) xStorageAlignmentBytes ) &
+                                                 ~( ( portPOINTER_SIZE_TYPE ) xStorageAlignmentBytes ) );
+            }
+            #endif
+
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            prvInitialiseNewStreamBuffer( ( StreamBuffer_t * ) pvAllocatedMemory,                         /* Structure at the start of the allocated memory. */
-                                                                                                          /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-                                                                                                          /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                                                                                                          /* coverity[misra_c_2012_rule_11_5_violation] */
-                                          ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t ), /* Storage area follows. */
+            prvInitialiseNewStreamBuffer( ( StreamBuffer_t * ) pvAllocatedMemory, /* Structure at the start of the allocated memory. */
+                                          pucStorageArea,                         /* Storage area follows. */
                                           xBufferSizeBytes,
                                           xTriggerLevelBytes,
                                           ucFlags,
@@ -462,6 +540,12 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             /* Statically allocated message buffer. */
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
             configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+
+            /* Records in an aligned message buffer occupy whole alignment
+             * units, so the storage area must be aligned and a whole number of
+             * units long. */
+            configASSERT( sbALIGN_MESSAGE_BYTES( xBufferSizeBytes ) == xBufferSizeBytes );
+            configASSERT( ( ( portPOINTER_SIZE_TYPE ) pucStreamBufferStorageArea & ( ( portPOINTER_SIZE_TYPE ) configMESSAGE_BUFFER_ALIGNMENT - 1U ) ) == 0U );
         }
         else if( xStreamBufferType == sbTYPE_STREAM_BATCHING_BUFFER )
         {
@@ -831,7 +915,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
      * message. */
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xRequiredSpace = sbALIGN_MESSAGE_BYTES( xRequiredSpace ) + sbBYTES_TO_STORE_MESSAGE_LENGTH;
 
         /* Overflow? */
         configASSERT( xRequiredSpace > xDataLengthBytes );
@@ -960,7 +1044,7 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
      * message. */
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xRequiredSpace = sbALIGN_MESSAGE_BYTES( xRequiredSpace ) + sbBYTES_TO_STORE_MESSAGE_LENGTH;
     }
     else
     {
@@ -1021,7 +1105,7 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
             /* There is enough space to write both the message length and the message
              * itself into the buffer.  Start by writing the length of the data, the data
              * itself will be written later in this function. */
-            xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xMessageLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+            xNextHead = prvWriteMessageLengthToBuffer( pxStreamBuffer, xMessageLength, xNextHead );
         }
         else
         {
@@ -1043,7 +1127,22 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
         /* MISRA Ref 11.5.5 [Void pointer assignment] */
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
         /* coverity[misra_c_2012_rule_11_5_violation] */
-        pxStreamBuffer->xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xNextHead );
+        xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xNextHead );
+
+        #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+        {
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                xNextHead = prvSkipMessagePadding( pxStreamBuffer, xNextHead, xDataLengthBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        pxStreamBuffer->xHead = xNextHead;
     }
 
     return xDataLengthBytes;
@@ -1186,7 +1285,7 @@ size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
             /* The number of bytes available is greater than the number of bytes
              * required to hold the length of the next message, so another message
              * is available. */
-            ( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+            ( void ) prvReadMessageLengthFromBuffer( pxStreamBuffer, &xTempReturn, pxStreamBuffer->xTail );
             xReturn = ( size_t ) xTempReturn;
         }
         else
@@ -1286,7 +1385,7 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
     {
         /* A discrete message is being received.  First receive the length
          * of the message. */
-        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+        xNextTail = prvReadMessageLengthFromBuffer( pxStreamBuffer, &xTempNextMessageLength, xNextTail );
         xNextMessageLength = ( size_t ) xTempNextMessageLength;
 
         /* Reduce the number of bytes available by the number of bytes just
@@ -1321,7 +1420,22 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
         /* MISRA Ref 11.5.5 [Void pointer assignment] */
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
         /* coverity[misra_c_2012_rule_11_5_violation] */
-        pxStreamBuffer->xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xNextTail );
+        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xNextTail );
+
+        #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+        {
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                xNextTail = prvSkipMessagePadding( pxStreamBuffer, xNextTail, xCount );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        pxStreamBuffer->xTail = xNextTail;
     }
 
     return xCount;
@@ -1489,7 +1603,7 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
 
     /* Write as many bytes as can be written in the first write. */
     configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
+    sbCOPY_BYTES( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
 
     /* If the number of bytes written was less than the number that could be
      * written in the first write... */
@@ -1497,7 +1611,7 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
     {
         /* ...then write the remaining bytes to the start of the buffer. */
         configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-        ( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
+        sbCOPY_BYTES( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
     }
     else
     {
@@ -1537,14 +1651,14 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
      * read.  Asserts check bounds of read and write. */
     configASSERT( xFirstLength <= xCount );
     configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+    sbCOPY_BYTES( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
 
     /* If the total number of wanted bytes is greater than the number
      * that could be read in the first read... */
     if( xCount > xFirstLength )
     {
         /* ...then read the remaining bytes from the start of the buffer. */
-        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
+        sbCOPY_BYTES( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
     }
     else
     {
@@ -1563,6 +1677,100 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+static size_t prvWriteMessageLengthToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                             configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength,
+                                             size_t xHead )
+{
+    if( ( pxStreamBuffer->xLength - xHead ) >= sbMESSAGE_LENGTH_FIELD_BYTES )
+    {
+        /* The field does not wrap.  As the buffer length is a whole number of
+         * alignment units the padding that follows the field cannot wrap
+         * either, so the whole record header is stepped over at once. */
+        ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) &xMessageLength, sbMESSAGE_LENGTH_FIELD_BYTES );
+        xHead += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+        if( xHead >= pxStreamBuffer->xLength )
+        {
+            xHead -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &xMessageLength, sbMESSAGE_LENGTH_FIELD_BYTES, xHead );
+
+        #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+        {
+            xHead = prvSkipMessagePadding( pxStreamBuffer, xHead, sbMESSAGE_LENGTH_FIELD_BYTES );
+        }
+        #endif
+    }
+
+    return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadMessageLengthFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                              configMESSAGE_BUFFER_LENGTH_TYPE * pxMessageLength,
+                                              size_t xTail )
+{
+    if( ( pxStreamBuffer->xLength - xTail ) >= sbMESSAGE_LENGTH_FIELD_BYTES )
+    {
+        /* The field does not wrap, nor can the padding that follows it - see
+         * prvWriteMessageLengthToBuffer(). */
+        ( void ) memcpy( ( void * ) pxMessageLength, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), sbMESSAGE_LENGTH_FIELD_BYTES );
+        xTail += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+        if( xTail >= pxStreamBuffer->xLength )
+        {
+            xTail -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pxMessageLength, sbMESSAGE_LENGTH_FIELD_BYTES, xTail );
+
+        #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+        {
+            xTail = prvSkipMessagePadding( pxStreamBuffer, xTail, sbMESSAGE_LENGTH_FIELD_BYTES );
+        }
+        #endif
+    }
+
+    return xTail;
+}
+/*-----------------------------------------------------------*/
+
+    #if ( configMESSAGE_BUFFER_ALIGNMENT > 1 )
+
+    static size_t prvSkipMessagePadding( const StreamBuffer_t * const pxStreamBuffer,
+                                         size_t xIndex,
+                                         size_t xUsedBytes )
+    {
+        xIndex += sbALIGN_MESSAGE_BYTES( xUsedBytes ) - xUsedBytes;
+
+        if( xIndex >= pxStreamBuffer->xLength )
+        {
+            xIndex -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xIndex;
+    }
+
+    #endif /* configMESSAGE_BUFFER_ALIGNMENT */
+/*-----------------------------------------------------------*/
+
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
 {
     /* Returns the distance between xTail and xHead. */
@@ -38,6 +38,7 @@
 /* FreeRTOS includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "queue.h"
 #include "timers.h"
 #include "stack_macros.h"
 
@@ -142,6 +143,12 @@
 #define tskDELETED_CHAR      ( 'D' )
 #define tskSUSPENDED_CHAR    ( 'S' )
 
+/*
+ * Size of the buffer the streaming formatting functions format each row into.
+ * Enough for the padded task name plus the widest numeric columns.
+ */
+#define tskSTATS_ROW_BUFFER_LENGTH    ( configMAX_TASK_NAME_LEN + 64U )
+
 /*
  * Some kernel aware debuggers require the data the debugger needs access to be
  * global, rather than file scope.
@@ -277,16 +284,77 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+/* Tasks in the ready list of configFAIR_SHARE_PRIORITY are held in order of
+ * their virtual run time, rather than in the order they became ready, so they
+ * are inserted by prvAddTaskToFairShareReadyList(). */
+    #define taskINSERT_INTO_READY_LIST( pxTCB )                                                                 \
+    do {                                                                                                        \
+        if( ( pxTCB )->uxPriority == ( UBaseType_t ) configFAIR_SHARE_PRIORITY )                                \
+        {                                                                                                       \
+            prvAddTaskToFairShareReadyList( pxTCB );                                                            \
+        }                                                                                                       \
+        else                                                                                                    \
+        {                                                                                                       \
+            listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+        }                                                                                                       \
+    } while( 0 )
+
+/* Virtual run times are compared by their difference, so they remain valid as
+ * the TickType_t values used to hold them overflow.  A task whose virtual run
+ * time is more than taskFAIR_SHARE_MAX_LEAD ahead of the least virtual run time
+ * in the fair share class is assumed to be stale, having been blocked while the
+ * virtual run times of the other tasks in the class overflowed. */
+    #define taskFAIR_SHARE_MAX_LEAD        ( portMAX_DELAY / ( TickType_t ) 4 )
+
+/* The ready list is sorted on the virtual run time of each task relative to
+ * xFairShareBaseVirtualRunTime.  The base is moved forward when a relative value
+ * would exceed taskFAIR_SHARE_REBASE_LIMIT. */
+    #define taskFAIR_SHARE_REBASE_LIMIT    ( portMAX_DELAY / ( TickType_t ) 2 )
+
+#else /* if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+
+    #define taskINSERT_INTO_READY_LIST( pxTCB ) \
+    listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) )
+
+#endif /* if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+/* The kernel locks are acquired and released through these macros so the
+ * time spent waiting for each lock, and the time each lock is held, can be
+ * recorded against the place in the kernel the lock was acquired. */
+    #define taskGET_TASK_LOCK( xCoreID, eSite )    prvGetKernelLock( eTaskLock, ( xCoreID ), ( eSite ) )
+    #define taskGET_ISR_LOCK( xCoreID, eSite )     prvGetKernelLock( eISRLock, ( xCoreID ), ( eSite ) )
+    #define taskRELEASE_TASK_LOCK( xCoreID )       prvReleaseKernelLock( eTaskLock, ( xCoreID ) )
+    #define taskRELEASE_ISR_LOCK( xCoreID )        prvReleaseKernelLock( eISRLock, ( xCoreID ) )
+
+/* The number of values in eKernelLock and eLockSite. */
+    #define taskNUMBER_OF_KERNEL_LOCKS             ( 2U )
+    #define taskNUMBER_OF_LOCK_SITES               ( 5U )
+
+#else /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+
+    #define taskGET_TASK_LOCK( xCoreID, eSite )    portGET_TASK_LOCK( xCoreID )
+    #define taskGET_ISR_LOCK( xCoreID, eSite )     portGET_ISR_LOCK( xCoreID )
+    #define taskRELEASE_TASK_LOCK( xCoreID )       portRELEASE_TASK_LOCK( xCoreID )
+    #define taskRELEASE_ISR_LOCK( xCoreID )        portRELEASE_ISR_LOCK( xCoreID )
+
+#endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )                                                                     \
-    do {                                                                                                   \
-        traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
-        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
-        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
-        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
+#define prvAddTaskToReadyList( pxTCB )                      \
+    do {                                                    \
+        traceMOVED_TASK_TO_READY_STATE( pxTCB );            \
+        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority ); \
+        taskINSERT_INTO_READY_LIST( pxTCB );                \
+        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );       \
     } while( 0 )
 /*-----------------------------------------------------------*/
 
@@ -332,6 +400,15 @@
 /* Indicates that the task is an Idle task. */
 #define taskATTRIBUTE_IS_IDLE    ( UBaseType_t ) ( 1U << 0U )
 
+/* The types of the TCB members that configUSE_COMPACT_TCB narrows. */
+#if ( configUSE_COMPACT_TCB == 1 )
+    #define taskTCB_UNSIGNED_TYPE    uint8_t
+    #define taskTCB_SIGNED_TYPE      int8_t
+#else
+    #define taskTCB_UNSIGNED_TYPE    UBaseType_t
+    #define taskTCB_SIGNED_TYPE      BaseType_t
+#endif
+
 #if ( ( configNUMBER_OF_CORES > 1 ) && ( portCRITICAL_NESTING_IN_TCB == 1 ) )
     #define portGET_CRITICAL_NESTING_COUNT( xCoreID )          ( pxCurrentTCBs[ ( xCoreID ) ]->uxCriticalNesting )
     #define portSET_CRITICAL_NESTING_COUNT( xCoreID, x )       ( pxCurrentTCBs[ ( xCoreID ) ]->uxCriticalNesting = ( x ) )
@@ -385,18 +462,66 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
 
     ListItem_t xStateListItem;                  /**< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
     ListItem_t xEventListItem;                  /**< Used to reference a task from an event list. */
-    UBaseType_t uxPriority;                     /**< The priority of the task.  0 is the lowest priority. */
+    #if ( configUSE_COMPACT_TCB == 0 )
+        UBaseType_t uxPriority;                 /**< The priority of the task.  0 is the lowest priority. */
+    #endif
     StackType_t * pxStack;                      /**< Points to the start of the stack. */
-    #if ( configNUMBER_OF_CORES > 1 )
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
         volatile BaseType_t xTaskRunState;      /**< Used to identify the core the task is running on, if the task is running. Otherwise, identifies the task's state - not running or yielding. */
         UBaseType_t uxTaskAttributes;           /**< Task's attributes - currently used to identify the idle tasks. */
     #endif
     char pcTaskName[ configMAX_TASK_NAME_LEN ]; /**< Descriptive name given to the task when created.  Facilitates debugging only. */
 
+    #if ( configUSE_COMPACT_TCB == 1 )
+        /* The same members as above and below, narrowed to a byte each and
+         * grouped so they share the padding after the task name.  The names of
+         * the wider members are kept. */
+        uint8_t uxPriority;                  /**< The priority of the task.  0 is the lowest priority. */
+        #if ( configNUMBER_OF_CORES > 1 )
+            volatile int8_t xTaskRunState;   /**< Used to identify the core the task is running on, if the task is running. Otherwise, identifies the task's state - not running or yielding. */
+            uint8_t uxTaskAttributes;        /**< Task's attributes - currently used to identify the idle tasks. */
+        #endif
+        #if ( configUSE_MUTEXES == 1 )
+            uint8_t uxBasePriority;          /**< The priority last assigned to the task - used by the priority inheritance mechanism. */
+            uint8_t uxMutexesHeld;
+        #endif
+    #endif
+
     #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
         BaseType_t xPreemptionDisable; /**< Used to prevent the task from being preempted. */
     #endif
 
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+        TickType_t xPreemptionDisableBudget; /**< The number of ticks the task may keep preemption disabled for, or 0 for no limit. */
+        TickType_t xPreemptionDisabledTime;  /**< The tick count when the task last disabled preemption. */
+        TickType_t xPreemptionDeferredTime;  /**< The tick count when a higher priority task was first kept waiting by the task's disabled preemption. */
+        BaseType_t xPreemptionDeferred;      /**< Set to pdTRUE when xPreemptionDeferredTime is valid. */
+        BaseType_t xPreemptionBudgetOverrun; /**< Set to pdTRUE once the overrun of the current window has been reported. */
+    #endif
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+        TickType_t xTimeSliceLength;    /**< The number of ticks the task runs for before it is time sliced with tasks of equal priority. */
+        TickType_t xTimeSliceRemaining; /**< The number of ticks left in the task's current time slice. */
+    #endif
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+        TickType_t xVirtualRunTime;     /**< The run time of the task while at configFAIR_SHARE_PRIORITY, scaled by its weight. */
+        UBaseType_t uxFairShareWeight;  /**< The task's share of the processor relative to other tasks at configFAIR_SHARE_PRIORITY. */
+        UBaseType_t uxFairShareCarry;   /**< The remainder of scaling the task's run time by its weight, carried into the next scaling so no run time is lost. */
+    #endif
+
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+        EventItemValue_t xEventItemValue; /**< Holds the value for the task while it waits in an unordered event list, as it does not fit in the value of xEventListItem. */
+    #endif
+
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        TickType_t xBlockedSince;                   /**< The tick count when the task last entered the Blocked state. */
+        TickType_t xBlockTimeLimit;                 /**< The number of ticks the task can wait for an event before it is reported, or 0 if it is never reported. */
+        void * pvBlockingMutex;                     /**< The mutex the task is blocked on, or NULL if it is not blocked on a mutex. */
+        TaskHandle_t const * pxBlockingMutexHolder; /**< Where the handle of the holder of pvBlockingMutex is stored. */
+        uint8_t ucBlockingReported;                 /**< Records which reports have been made for the current wait, so each is only made once. */
+    #endif
+
     #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
         StackType_t * pxEndOfStack; /**< Points to the highest valid address for the stack. */
     #endif
@@ -410,7 +535,7 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         UBaseType_t uxTaskNumber; /**< Stores a number specifically for use by third party trace code. */
     #endif
 
-    #if ( configUSE_MUTEXES == 1 )
+    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
         UBaseType_t uxBasePriority; /**< The priority last assigned to the task - used by the priority inheritance mechanism. */
         UBaseType_t uxMutexesHeld;
     #endif
@@ -479,6 +604,13 @@ PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /**< Po
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /**< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+    PRIVILEGED_DATA static TickType_t xFairShareMinVirtualRunTime = ( TickType_t ) 0U;  /**< The virtual run time of the fair share task selected to run most recently.  No ready fair share task has a lower virtual run time. */
+    PRIVILEGED_DATA static TickType_t xFairShareBaseVirtualRunTime = ( TickType_t ) 0U; /**< The virtual run time the fair share ready list item values are relative to. */
+
+#endif
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
     PRIVILEGED_DATA static List_t xTasksWaitingTermination; /**< Tasks that have been deleted - but their memory not yet freed. */
@@ -538,6 +670,56 @@ PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime[ conf
 
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+/* Records which core holds a kernel lock and since when.  The holder of each
+ * lock, and the statistics of each lock, are only accessed by the core holding
+ * that lock. */
+typedef struct xKERNEL_LOCK_HOLDER
+{
+    configRUN_TIME_COUNTER_TYPE ulAcquiredTime; /**< The time the lock was acquired. */
+    eLockSite eSite;                            /**< The place in the kernel the lock was acquired. */
+    UBaseType_t uxNesting;                      /**< The number of times the holder has acquired the lock without releasing it. */
+} KernelLockHolder_t;
+
+PRIVILEGED_DATA static KernelLockHolder_t xKernelLockHolders[ taskNUMBER_OF_KERNEL_LOCKS ];
+PRIVILEGED_DATA static LockStatistics_t xLockStatistics[ taskNUMBER_OF_LOCK_SITES ][ taskNUMBER_OF_KERNEL_LOCKS ];
+
+#endif
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+/* Only accessed from critical sections. */
+PRIVILEGED_DATA static PreemptionDisableStatistics_t xPreemptionDisableStatistics;
+
+#endif
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+/* The chain of tasks passed to vApplicationDeadlockHook().  Held here rather
+ * than on the stack of the idle task, which normally runs the check, so the
+ * idle task's stack does not depend on
+ * configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH.  Only accessed with the scheduler
+ * suspended. */
+PRIVILEGED_DATA static TaskWaitLink_t xDeadlockChain[ configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH ];
+
+#endif
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+/* The position reached by the streaming task table functions, which walk the
+ * state lists in the same order as uxTaskGetSystemState() but suspend the
+ * scheduler for one task at a time. */
+typedef struct xTASK_STATUS_CURSOR
+{
+    UBaseType_t uxList;         /**< The state list being walked, see prvGetTaskStatusList(). */
+    UBaseType_t uxPosition;     /**< The number of tasks already reported from that list. */
+    ListItem_t * pxLastItem;    /**< The state list item of the task reported last, or NULL if none has been reported from the list yet. */
+    UBaseType_t uxTaskNumber;   /**< The value of uxTaskNumber when pxLastItem was recorded. */
+} TaskStatusCursor_t;
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* File private functions. --------------------------------*/
@@ -556,6 +738,19 @@ static BaseType_t prvCreateIdleTasks( void );
     static void prvCheckForRunStateChange( void );
 #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+/*
+ * Acquire and release a kernel lock, recording the time spent waiting for the
+ * lock and the time the lock is held.
+ */
+    static void prvGetKernelLock( eKernelLock eLock,
+                                  BaseType_t xCoreID,
+                                  eLockSite eSite );
+    static void prvReleaseKernelLock( eKernelLock eLock,
+                                      BaseType_t xCoreID );
+#endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+
 #if ( configNUMBER_OF_CORES > 1 )
 
 /*
@@ -670,7 +865,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  * This function determines the 'high water mark' of the task stack by
  * determining how much of the stack remains at the original preset value.
  */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_KERNEL_SNAPSHOT == 1 ) )
 
     static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
 
@@ -698,6 +893,137 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+/*
+ * Insert a task into the ready list of configFAIR_SHARE_PRIORITY in order of
+ * virtual run time.  Called from within a critical section.  Takes time
+ * proportional to the number of tasks already in the list: at worst one pass to
+ * rebase their list item values and one to find the insertion point.  The list
+ * holds at most configFAIR_SHARE_MAX_READY_TASKS tasks, which bounds that time.
+ */
+    static void prvAddTaskToFairShareReadyList( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add the processor time the task used while it was running, scaled by the
+ * task's weight, to the virtual run time of a fair share task, and move the task
+ * to its new position in the ready list if it is still ready.
+ */
+    static void prvChargeFairShareTask( TCB_t * const pxTCB,
+                                        configRUN_TIME_COUNTER_TYPE ulRunTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by vTaskSwitchContext() after the highest priority ready list has been
+ * selected.  If that is the ready list of configFAIR_SHARE_PRIORITY then the task
+ * with the least virtual run time is selected in place of the next task in
+ * round robin order.
+ */
+    static void prvSelectFairShareTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+/* Bits of ucBlockingReported. */
+    #define taskMUTEX_DEADLOCK_REPORTED          ( ( uint8_t ) 0x01U )
+    #define taskBLOCK_TIME_LIMIT_REPORTED        ( ( uint8_t ) 0x02U )
+
+/*
+ * Returns pdTRUE if a task that is in the Blocked or Suspended state is waiting
+ * for an event, as opposed to being delayed or suspended.
+ */
+    static BaseType_t prvTaskIsWaiting( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the holder of the mutex the task is waiting for, or NULL if the task
+ * is not waiting for a mutex or the mutex has no holder.
+ */
+    static TCB_t * prvGetBlockingMutexHolder( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fills pxChain with the task, then the holder of the mutex it is waiting for,
+ * then the holder of the mutex that task is waiting for, and so on.  Returns
+ * the number of tasks in the chain, and sets *pxDeadlocked to pdTRUE if the
+ * chain leads back to the task.
+ */
+    static UBaseType_t prvGetWaitChain( TCB_t * pxTCB,
+                                        TickType_t xTimeNow,
+                                        TaskWaitLink_t * pxChain,
+                                        BaseType_t * pxDeadlocked ) PRIVILEGED_FUNCTION;
+
+/*
+ * Performs the checks made by vTaskCheckForDeadlocks() on each task in pxList.
+ */
+    static void prvCheckListForDeadlocks( const List_t * pxList,
+                                          TickType_t xTimeNow,
+                                          TaskWaitLink_t * pxChain ) PRIVILEGED_FUNCTION;
+
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+/*
+ * Starts a snapshot record of type ulType holding xLength bytes of data.
+ * Returns pdFALSE, and marks the snapshot as truncated, if the record does not
+ * fit in the remaining space, in which case the data must not be written.
+ */
+    static BaseType_t prvSnapshotBeginRecord( SnapshotWriter_t * pxWriter,
+                                              uint32_t ulType,
+                                              size_t xLength ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies xLength bytes to the snapshot.  The space must have been reserved by
+ * prvSnapshotBeginRecord().
+ */
+    static void prvSnapshotWrite( SnapshotWriter_t * pxWriter,
+                                  const void * pvData,
+                                  size_t xLength ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds the kernel variables held in this file to the snapshot.
+ */
+    static void prvSnapshotWriteKernelData( SnapshotWriter_t * pxWriter ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds each task in pxList, which are in state eState unless they are
+ * running, to the snapshot.
+ */
+    static void prvSnapshotWriteTasksWithinList( SnapshotWriter_t * pxWriter,
+                                                 const List_t * pxList,
+                                                 eTaskState eState ) PRIVILEGED_FUNCTION;
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+/*
+ * Called from the tick interrupt for a running task that shares its priority
+ * with other ready tasks.  Counts down the task's time slice, returning pdTRUE,
+ * and starting the task's next time slice, when the current slice has been
+ * used up.
+ */
+    static BaseType_t prvTimeSliceExpired( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+/*
+ * Called, from a critical section, when the task referenced by pxTCB enables
+ * preemption again, to add the window it had preemption disabled for to the
+ * preemption disable statistics.
+ */
+    static void prvEndPreemptionDisableWindow( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called from the tick interrupt to report the running tasks that have kept
+ * preemption disabled for longer than their budget.  Sets the yield pending
+ * flag of each core on which the application hook enabled preemption again.
+ */
+    static void prvCheckPreemptionDisableBudgets( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -709,6 +1035,55 @@ static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+/*
+ * Helper function used to format one row of the vTaskListTasks() table into
+ * pcBuffer.  Returns the number of characters written and sets *pxBufferFull
+ * to pdTRUE if the row did not fit.
+ */
+    static size_t prvWriteTaskListRow( char * pcBuffer,
+                                       size_t uxBufferLength,
+                                       const TaskStatus_t * pxTaskStatus,
+                                       BaseType_t * pxBufferFull ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the uxList'th state list in the order uxTaskGetSystemState() reports
+ * them, and sets *peState to the state of the tasks on it.  Returns NULL if
+ * the list is not included in this build, or uxList is past the last list.
+ */
+    static List_t * prvGetTaskStatusList( UBaseType_t uxList,
+                                          eTaskState * peState ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fills in *pxTaskStatus for the task that follows the one *pxCursor reached,
+ * and advances *pxCursor to it, allowing the streaming formatting functions to
+ * visit every task without allocating a TaskStatus_t array.  Returns pdFALSE
+ * when there are no more tasks.  While no task has been created or deleted and
+ * the task reported last is still on the same list, the next task is found in
+ * O(1) from the saved list item.  Otherwise the list is walked from its head to
+ * the saved position.
+ */
+    static BaseType_t prvGetNextTaskStatus( TaskStatusCursor_t * pxCursor,
+                                            TaskStatus_t * pxTaskStatus,
+                                            configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+
+/*
+ * Helper function used to format one row of the vTaskGetRunTimeStatistics()
+ * table into pcBuffer.  ulTotalTime is the total run time divided by 100.
+ */
+    static size_t prvWriteRunTimeStatsRow( char * pcBuffer,
+                                           size_t uxBufferLength,
+                                           const TaskStatus_t * pxTaskStatus,
+                                           configRUN_TIME_COUNTER_TYPE ulTotalTime,
+                                           BaseType_t * pxBufferFull ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Called after a Task_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -847,7 +1222,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             if( uxPrevCriticalNesting > 0U )
             {
                 portSET_CRITICAL_NESTING_COUNT( xCoreID, 0U );
-                portRELEASE_ISR_LOCK( xCoreID );
+                taskRELEASE_ISR_LOCK( xCoreID );
             }
             else
             {
@@ -856,7 +1231,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            portRELEASE_TASK_LOCK( xCoreID );
+            taskRELEASE_TASK_LOCK( xCoreID );
             portMEMORY_BARRIER();
             configASSERT( pxThisTCB->xTaskRunState == taskTASK_SCHEDULED_TO_YIELD );
 
@@ -871,14 +1246,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             portDISABLE_INTERRUPTS();
 
             xCoreID = ( BaseType_t ) portGET_CORE_ID();
-            portGET_TASK_LOCK( xCoreID );
-            portGET_ISR_LOCK( xCoreID );
+            taskGET_TASK_LOCK( xCoreID, eLockSiteRunStateChange );
+            taskGET_ISR_LOCK( xCoreID, eLockSiteRunStateChange );
 
             portSET_CRITICAL_NESTING_COUNT( xCoreID, uxPrevCriticalNesting );
 
             if( uxPrevCriticalNesting == 0U )
             {
-                portRELEASE_ISR_LOCK( xCoreID );
+                taskRELEASE_ISR_LOCK( xCoreID );
             }
         }
     }
@@ -886,6 +1261,115 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
 /*-----------------------------------------------------------*/
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+    static void prvGetKernelLock( eKernelLock eLock,
+                                  BaseType_t xCoreID,
+                                  eLockSite eSite )
+    {
+        KernelLockHolder_t * const pxHolder = &( xKernelLockHolders[ eLock ] );
+        LockStatistics_t * pxLockStatistics;
+        configRUN_TIME_COUNTER_TYPE ulStartTime;
+        configRUN_TIME_COUNTER_TYPE ulWaitTime;
+
+        /* Prevent unused parameter warning when the port's lock macros do not
+         * use the core ID. */
+        ( void ) xCoreID;
+
+        ulStartTime = portGET_LOCK_STATISTICS_TIMESTAMP();
+
+        if( eLock == eTaskLock )
+        {
+            portGET_TASK_LOCK( xCoreID );
+        }
+        else
+        {
+            portGET_ISR_LOCK( xCoreID );
+        }
+
+        /* The lock is now held by this core, so its holder and statistics can
+         * be updated.  A lock this core already held is not recorded again. */
+        if( pxHolder->uxNesting == 0U )
+        {
+            pxHolder->ulAcquiredTime = portGET_LOCK_STATISTICS_TIMESTAMP();
+            pxHolder->eSite = eSite;
+            ulWaitTime = pxHolder->ulAcquiredTime - ulStartTime;
+
+            pxLockStatistics = &( xLockStatistics[ eSite ][ eLock ] );
+            ( pxLockStatistics->ulAcquisitions )++;
+            pxLockStatistics->ulTotalWaitTime += ulWaitTime;
+
+            if( ulWaitTime > pxLockStatistics->ulMaxWaitTime )
+            {
+                pxLockStatistics->ulMaxWaitTime = ulWaitTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceKERNEL_LOCK_ACQUIRED( eLock, eSite, ulWaitTime );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( pxHolder->uxNesting )++;
+    }
+#endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+    static void prvReleaseKernelLock( eKernelLock eLock,
+                                      BaseType_t xCoreID )
+    {
+        KernelLockHolder_t * const pxHolder = &( xKernelLockHolders[ eLock ] );
+        LockStatistics_t * pxLockStatistics;
+        configRUN_TIME_COUNTER_TYPE ulHoldTime;
+
+        /* Prevent unused parameter warning when the port's lock macros do not
+         * use the core ID. */
+        ( void ) xCoreID;
+
+        configASSERT( pxHolder->uxNesting > 0U );
+        ( pxHolder->uxNesting )--;
+
+        /* Record the hold time while the lock is still held. */
+        if( pxHolder->uxNesting == 0U )
+        {
+            ulHoldTime = portGET_LOCK_STATISTICS_TIMESTAMP() - pxHolder->ulAcquiredTime;
+
+            pxLockStatistics = &( xLockStatistics[ pxHolder->eSite ][ eLock ] );
+            pxLockStatistics->ulTotalHoldTime += ulHoldTime;
+
+            if( ulHoldTime > pxLockStatistics->ulMaxHoldTime )
+            {
+                pxLockStatistics->ulMaxHoldTime = ulHoldTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceKERNEL_LOCK_RELEASED( eLock, pxHolder->eSite, ulHoldTime );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( eLock == eTaskLock )
+        {
+            portRELEASE_TASK_LOCK( xCoreID );
+        }
+        else
+        {
+            portRELEASE_ISR_LOCK( xCoreID );
+        }
+    }
+#endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( configNUMBER_OF_CORES > 1 )
     static void prvYieldForTask( const TCB_t * pxTCB )
     {
@@ -899,6 +1383,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             BaseType_t xYieldCount = 0;
         #endif /* #if ( configRUN_MULTIPLE_PRIORITIES == 0 ) */
 
+        #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+            BaseType_t xDeferredCore = ( BaseType_t ) -1;
+        #endif
+
         /* This must be called from a critical section. */
         configASSERT( portGET_CRITICAL_NESTING_COUNT( xCurrentCoreID ) > 0U );
 
@@ -947,6 +1435,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                                     xLowestPriorityToPreempt = xCurrentCoreTaskPriority;
                                     xLowestPriorityCore = xCoreID;
                                 }
+                                #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+                                    else
+                                    {
+                                        /* This core would have been yielded had
+                                         * its task not disabled preemption. */
+                                        xDeferredCore = xCoreID;
+                                    }
+                                #endif
                             }
                         }
                         else
@@ -987,6 +1483,22 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 prvYieldCore( xLowestPriorityCore );
             }
 
+            #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+            {
+                /* pxTCB is kept waiting only if no other core could run it. */
+                if( ( xLowestPriorityCore < 0 ) && ( xDeferredCore >= 0 ) &&
+                    ( pxCurrentTCBs[ xDeferredCore ]->xPreemptionDeferred == pdFALSE ) )
+                {
+                    pxCurrentTCBs[ xDeferredCore ]->xPreemptionDeferred = pdTRUE;
+                    pxCurrentTCBs[ xDeferredCore ]->xPreemptionDeferredTime = xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+
             #if ( configRUN_MULTIPLE_PRIORITIES == 0 )
                 /* Verify that the calling core always yields to higher priority tasks. */
                 if( ( ( pxCurrentTCBs[ xCurrentCoreID ]->uxTaskAttributes & taskATTRIBUTE_IS_IDLE ) == 0U ) &&
@@ -1094,7 +1606,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                             #if ( configUSE_CORE_AFFINITY == 1 )
                                 pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
                             #endif
-                            pxTCB->xTaskRunState = xCoreID;
+                            pxTCB->xTaskRunState = ( taskTCB_SIGNED_TYPE ) xCoreID;
                             pxCurrentTCBs[ xCoreID ] = pxTCB;
                             xTaskScheduled = pdTRUE;
                         }
@@ -1108,7 +1620,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                         #endif
                         {
                             /* The task is already running on this core, mark it as scheduled. */
-                            pxTCB->xTaskRunState = xCoreID;
+                            pxTCB->xTaskRunState = ( taskTCB_SIGNED_TYPE ) xCoreID;
                             xTaskScheduled = pdTRUE;
                         }
                     }
@@ -1922,13 +2434,36 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    pxNewTCB->uxPriority = uxPriority;
+    pxNewTCB->uxPriority = ( taskTCB_UNSIGNED_TYPE ) uxPriority;
     #if ( configUSE_MUTEXES == 1 )
     {
-        pxNewTCB->uxBasePriority = uxPriority;
+        pxNewTCB->uxBasePriority = ( taskTCB_UNSIGNED_TYPE ) uxPriority;
     }
     #endif /* configUSE_MUTEXES */
 
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+    {
+        pxNewTCB->xTimeSliceLength = ( TickType_t ) configDEFAULT_TIME_SLICE_LENGTH;
+        pxNewTCB->xTimeSliceRemaining = ( TickType_t ) configDEFAULT_TIME_SLICE_LENGTH;
+    }
+    #endif /* configUSE_TIME_SLICE_LENGTH */
+
+    #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+    {
+        pxNewTCB->xPreemptionDisableBudget = ( TickType_t ) configDEFAULT_PREEMPTION_DISABLE_BUDGET;
+    }
+    #endif /* configUSE_PREEMPTION_DISABLE_BUDGET */
+
+    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+    {
+        /* Start level with the fair share tasks that are already running, so
+         * the new task neither starves them nor is starved by them. */
+        pxNewTCB->xVirtualRunTime = xFairShareMinVirtualRunTime;
+        pxNewTCB->uxFairShareWeight = tskDEFAULT_FAIR_SHARE_WEIGHT;
+        pxNewTCB->uxFairShareCarry = ( UBaseType_t ) 0U;
+    }
+    #endif /* configUSE_FAIR_SHARE_SCHEDULING */
+
     vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
     vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -2905,7 +3440,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                      * is bigger than the inherited priority. */
                     if( ( pxTCB->uxBasePriority == pxTCB->uxPriority ) || ( uxNewPriority > pxTCB->uxPriority ) )
                     {
-                        pxTCB->uxPriority = uxNewPriority;
+                        pxTCB->uxPriority = ( taskTCB_UNSIGNED_TYPE ) uxNewPriority;
                     }
                     else
                     {
@@ -2913,11 +3448,11 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                     }
 
                     /* The base priority gets set whatever. */
-                    pxTCB->uxBasePriority = uxNewPriority;
+                    pxTCB->uxBasePriority = ( taskTCB_UNSIGNED_TYPE ) uxNewPriority;
                 }
                 #else /* if ( configUSE_MUTEXES == 1 ) */
                 {
-                    pxTCB->uxPriority = uxNewPriority;
+                    pxTCB->uxPriority = ( taskTCB_UNSIGNED_TYPE ) uxNewPriority;
                 }
                 #endif /* if ( configUSE_MUTEXES == 1 ) */
 
@@ -3101,6 +3636,20 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             pxTCB = prvGetTCBFromHandle( xTask );
             configASSERT( pxTCB != NULL );
 
+            #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+            {
+                /* Disabling preemption again does not restart the window. */
+                if( pxTCB->xPreemptionDisable == pdFALSE )
+                {
+                    pxTCB->xPreemptionDisabledTime = xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+
             pxTCB->xPreemptionDisable = pdTRUE;
         }
         taskEXIT_CRITICAL();
@@ -3125,6 +3674,19 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             pxTCB = prvGetTCBFromHandle( xTask );
             configASSERT( pxTCB != NULL );
 
+            #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+            {
+                if( pxTCB->xPreemptionDisable != pdFALSE )
+                {
+                    prvEndPreemptionDisableWindow( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+
             pxTCB->xPreemptionDisable = pdFALSE;
 
             if( xSchedulerRunning != pdFALSE )
@@ -3144,19 +3706,651 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 #endif /* #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
 
-    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    void vTaskPreemptionDisableBudgetSet( TaskHandle_t xTask,
+                                          TickType_t xTicks )
     {
         TCB_t * pxTCB;
 
-        traceENTER_vTaskSuspend( xTaskToSuspend );
+        traceENTER_vTaskPreemptionDisableBudgetSet( xTask, xTicks );
 
         taskENTER_CRITICAL();
         {
-            /* If null is passed in here then it is the running task that is
-             * being suspended. */
-            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            pxTCB->xPreemptionDisableBudget = xTicks;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskPreemptionDisableBudgetSet();
+    }
+
+#endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+    TickType_t xTaskPreemptionDisableBudgetGet( ConstTaskHandle_t xTask )
+    {
+        const TCB_t * pxTCB;
+        TickType_t xReturn;
+
+        traceENTER_xTaskPreemptionDisableBudgetGet( xTask );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            xReturn = pxTCB->xPreemptionDisableBudget;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xTaskPreemptionDisableBudgetGet( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+    void vTaskGetPreemptionDisableStatistics( PreemptionDisableStatistics_t * pxStatistics )
+    {
+        traceENTER_vTaskGetPreemptionDisableStatistics( pxStatistics );
+
+        configASSERT( pxStatistics != NULL );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStatistics = xPreemptionDisableStatistics;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskGetPreemptionDisableStatistics();
+    }
+
+#endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+
+    void vTaskResetPreemptionDisableStatistics( void )
+    {
+        traceENTER_vTaskResetPreemptionDisableStatistics();
+
+        taskENTER_CRITICAL();
+        {
+            ( void ) memset( ( void * ) &xPreemptionDisableStatistics, 0x00, sizeof( xPreemptionDisableStatistics ) );
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskResetPreemptionDisableStatistics();
+    }
+
+#endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+    void vTaskTimeSliceSet( TaskHandle_t xTask,
+                            TickType_t xTicks )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskTimeSliceSet( xTask, xTicks );
+
+        configASSERT( xTicks > ( TickType_t ) 0U );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            pxTCB->xTimeSliceLength = xTicks;
+
+            /* The new length takes effect from the task's next time slice,
+             * unless that is later than the end of the current slice would be
+             * with the new length. */
+            if( pxTCB->xTimeSliceRemaining > xTicks )
+            {
+                pxTCB->xTimeSliceRemaining = xTicks;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskTimeSliceSet();
+    }
+
+#endif /* #if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+    TickType_t xTaskTimeSliceGet( ConstTaskHandle_t xTask )
+    {
+        const TCB_t * pxTCB;
+        TickType_t xReturn;
+
+        traceENTER_xTaskTimeSliceGet( xTask );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            xReturn = pxTCB->xTimeSliceLength;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xTaskTimeSliceGet( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+    void vTaskFairShareWeightSet( TaskHandle_t xTask,
+                                  UBaseType_t uxWeight )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskFairShareWeightSet( xTask, uxWeight );
+
+        /* The upper limit of 0xFFFF prevents the scaling performed by
+         * prvChargeFairShareTask() overflowing a 32-bit run time counter.  It
+         * is tested by shifting rather than comparing, as the comparison is
+         * always true, and so warned about, when UBaseType_t is 8 or 16 bits
+         * wide.  The shift is split as an 8-bit UBaseType_t is promoted to an
+         * int that can be 16 bits wide. */
+        configASSERT( ( uxWeight > ( UBaseType_t ) 0U ) && ( ( ( uxWeight >> 8U ) >> 8U ) == ( UBaseType_t ) 0U ) );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            pxTCB->uxFairShareWeight = uxWeight;
+            pxTCB->uxFairShareCarry = ( UBaseType_t ) 0U;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskFairShareWeightSet();
+    }
+
+#endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+    UBaseType_t uxTaskFairShareWeightGet( ConstTaskHandle_t xTask )
+    {
+        const TCB_t * pxTCB;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxTaskFairShareWeightGet( xTask );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            uxReturn = pxTCB->uxFairShareWeight;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_uxTaskFairShareWeightGet( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+    void vTaskSetBlockTimeLimit( TaskHandle_t xTask,
+                                 TickType_t xBlockTimeLimit )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskSetBlockTimeLimit( xTask, xBlockTimeLimit );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            pxTCB->xBlockTimeLimit = xBlockTimeLimit;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskSetBlockTimeLimit();
+    }
+
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+    void vTaskSetBlockingMutex( void * pvMutex,
+                                TaskHandle_t const * pxMutexHolder )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( NULL );
+
+        traceENTER_vTaskSetBlockingMutex( pvMutex, pxMutexHolder );
+
+        pxTCB->pvBlockingMutex = pvMutex;
+        pxTCB->pxBlockingMutexHolder = pxMutexHolder;
+
+        traceRETURN_vTaskSetBlockingMutex();
+    }
+
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+    void vTaskCheckForDeadlocks( void )
+    {
+        TickType_t xTimeNow;
+
+        traceENTER_vTaskCheckForDeadlocks();
+
+        /* Suspending the scheduler keeps the Blocked and Suspended lists, and
+         * the mutex holders, from changing during the check. */
+        vTaskSuspendAll();
+        {
+            xTimeNow = xTickCount;
+
+            prvCheckListForDeadlocks( pxDelayedTaskList, xTimeNow, xDeadlockChain );
+            prvCheckListForDeadlocks( pxOverflowDelayedTaskList, xTimeNow, xDeadlockChain );
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                /* Tasks waiting without a timeout are in the Suspended list. */
+                prvCheckListForDeadlocks( &xSuspendedTaskList, xTimeNow, xDeadlockChain );
+            }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        traceRETURN_vTaskCheckForDeadlocks();
+    }
+
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+    size_t xTaskWriteSnapshot( void * pvBuffer,
+                               size_t xBufferSize )
+    {
+        SnapshotWriter_t xWriter;
+        const size_t xEndRecordSize = sizeof( uint32_t ) * ( size_t ) 4U;
+        const uint32_t ulMagic = tskSNAPSHOT_MAGIC;
+        uint32_t ulValue;
+        UBaseType_t uxPriority;
+        size_t xReturn = ( size_t ) 0U;
+        const uint8_t ucTarget[ 8 ] =
+        {
+            tskSNAPSHOT_VERSION,
+            ( uint8_t ) sizeof( void * ),
+            ( uint8_t ) sizeof( TickType_t ),
+            ( uint8_t ) sizeof( UBaseType_t ),
+            ( uint8_t ) sizeof( StackType_t ),
+            ( uint8_t ) ( ( portSTACK_GROWTH > 0 ) ? 1U : 0U ),
+            ( uint8_t ) configNUMBER_OF_CORES,
+            ( uint8_t ) 0U
+        };
+
+        traceENTER_xTaskWriteSnapshot( pvBuffer, xBufferSize );
+
+        /* This function may be called from a fault handler, when the kernel
+         * data cannot be assumed to be consistent, so it does not suspend the
+         * scheduler or enter a critical section. */
+        if( ( pvBuffer != NULL ) && ( xBufferSize >= ( xEndRecordSize + sizeof( ulMagic ) + sizeof( ucTarget ) + ( sizeof( uint32_t ) * ( size_t ) 2U ) ) ) )
+        {
+            xWriter.pucBuffer = ( uint8_t * ) pvBuffer;
+            xWriter.xBufferSize = xBufferSize - xEndRecordSize;
+            xWriter.xBytesWritten = ( size_t ) 0U;
+            xWriter.xTruncated = pdFALSE;
+
+            ( void ) prvSnapshotBeginRecord( &xWriter, tskSNAPSHOT_RECORD_START, sizeof( ulMagic ) + sizeof( ucTarget ) );
+            prvSnapshotWrite( &xWriter, &ulMagic, sizeof( ulMagic ) );
+            prvSnapshotWrite( &xWriter, ucTarget, sizeof( ucTarget ) );
+
+            prvSnapshotWriteKernelData( &xWriter );
+
+            for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+            {
+                prvSnapshotWriteTasksWithinList( &xWriter, &( pxReadyTasksLists[ uxPriority ] ), eReady );
+            }
+
+            prvSnapshotWriteTasksWithinList( &xWriter, &xDelayedTaskList1, eBlocked );
+            prvSnapshotWriteTasksWithinList( &xWriter, &xDelayedTaskList2, eBlocked );
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+            {
+                prvSnapshotWriteTasksWithinList( &xWriter, &xTasksWaitingTermination, eDeleted );
+            }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                prvSnapshotWriteTasksWithinList( &xWriter, &xSuspendedTaskList, eSuspended );
+            }
+            #endif
+
+            #if ( configQUEUE_REGISTRY_SIZE > 0 )
+            {
+                vQueueWriteSnapshot( &xWriter );
+            }
+            #endif
+
+            #if ( configUSE_TIMERS == 1 )
+            {
+                vTimerWriteSnapshot( &xWriter );
+            }
+            #endif
+
+            #if ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 )
+            {
+                vPortWriteHeapSnapshot( &xWriter );
+            }
+            #endif
+
+            /* Space for the end record was reserved at the start. */
+            xWriter.xBufferSize += xEndRecordSize;
+            ulValue = tskSNAPSHOT_RECORD_END;
+            prvSnapshotWrite( &xWriter, &ulValue, sizeof( ulValue ) );
+            ulValue = ( uint32_t ) ( sizeof( uint32_t ) * 2U );
+            prvSnapshotWrite( &xWriter, &ulValue, sizeof( ulValue ) );
+            ulValue = ( uint32_t ) ( xWriter.xBytesWritten + ( sizeof( uint32_t ) * 2U ) );
+            prvSnapshotWrite( &xWriter, &ulValue, sizeof( ulValue ) );
+            ulValue = ( xWriter.xTruncated != pdFALSE ) ? tskSNAPSHOT_TRUNCATED : ( uint32_t ) 0U;
+            prvSnapshotWrite( &xWriter, &ulValue, sizeof( ulValue ) );
+
+            xReturn = xWriter.xBytesWritten;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskWriteSnapshot( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+    void vTaskSnapshotWriteMemory( SnapshotWriter_t * pxWriter,
+                                   uint32_t ulKind,
+                                   const void * pvAddress,
+                                   size_t xLength )
+    {
+        const portPOINTER_SIZE_TYPE uxAddress = ( portPOINTER_SIZE_TYPE ) pvAddress;
+
+        if( prvSnapshotBeginRecord( pxWriter, tskSNAPSHOT_RECORD_MEMORY, sizeof( ulKind ) + sizeof( uxAddress ) + xLength ) != pdFALSE )
+        {
+            prvSnapshotWrite( pxWriter, &ulKind, sizeof( ulKind ) );
+            prvSnapshotWrite( pxWriter, &uxAddress, sizeof( uxAddress ) );
+            prvSnapshotWrite( pxWriter, pvAddress, xLength );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) )
+
+    void vTaskSnapshotWriteFreeBlocks( SnapshotWriter_t * pxWriter,
+                                       const void * pvFirstBlock,
+                                       const void * pvEnd,
+                                       size_t xBlockSize,
+                                       portPOINTER_SIZE_TYPE uxPointerMask )
+    {
+        const uint8_t * pucBlock = ( const uint8_t * ) pvFirstBlock;
+        const uint8_t * pucPreviousBlock = NULL;
+        portPOINTER_SIZE_TYPE uxNextBlock;
+
+        while( ( pucBlock != NULL ) &&
+               ( pucBlock < ( const uint8_t * ) pvEnd ) &&
+               ( ( pucPreviousBlock == NULL ) || ( pucBlock > pucPreviousBlock ) ) &&
+               ( pxWriter->xTruncated == pdFALSE ) )
+        {
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_HEAP, pucBlock, xBlockSize );
+
+            ( void ) memcpy( &uxNextBlock, pucBlock, sizeof( uxNextBlock ) );
+            pucPreviousBlock = pucBlock;
+            pucBlock = ( const uint8_t * ) ( uxNextBlock ^ uxPointerMask );
+        }
+    }
+
+#endif /* #if ( ( configUSE_KERNEL_SNAPSHOT == 1 ) && ( configKERNEL_SNAPSHOT_INCLUDE_HEAP == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+    static BaseType_t prvSnapshotBeginRecord( SnapshotWriter_t * pxWriter,
+                                              uint32_t ulType,
+                                              size_t xLength )
+    {
+        BaseType_t xReturn = pdFALSE;
+        const size_t xSpace = pxWriter->xBufferSize - pxWriter->xBytesWritten;
+        uint32_t ulLength;
+
+        /* Once one record has not fit no more are written, so the records
+         * that are present are a prefix of the full snapshot. */
+        if( ( pxWriter->xTruncated == pdFALSE ) &&
+            ( xSpace >= ( sizeof( uint32_t ) * 2U ) ) &&
+            ( xLength <= ( xSpace - ( sizeof( uint32_t ) * 2U ) ) ) )
+        {
+            ulLength = ( uint32_t ) xLength;
+            prvSnapshotWrite( pxWriter, &ulType, sizeof( ulType ) );
+            prvSnapshotWrite( pxWriter, &ulLength, sizeof( ulLength ) );
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            pxWriter->xTruncated = pdTRUE;
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+    static void prvSnapshotWrite( SnapshotWriter_t * pxWriter,
+                                  const void * pvData,
+                                  size_t xLength )
+    {
+        ( void ) memcpy( &( pxWriter->pucBuffer[ pxWriter->xBytesWritten ] ), pvData, xLength );
+        pxWriter->xBytesWritten += xLength;
+    }
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+    static void prvSnapshotWriteKernelData( SnapshotWriter_t * pxWriter )
+    {
+        /* The volatile qualifiers are cast away as the values are only
+         * copied. */
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &pxCurrentTCB, sizeof( pxCurrentTCB ) );
+        }
+        #else
+        {
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) pxCurrentTCBs, sizeof( pxCurrentTCBs ) );
+        }
+        #endif
+
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, pxReadyTasksLists, sizeof( pxReadyTasksLists ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xDelayedTaskList1, sizeof( xDelayedTaskList1 ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xDelayedTaskList2, sizeof( xDelayedTaskList2 ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &pxDelayedTaskList, sizeof( pxDelayedTaskList ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &pxOverflowDelayedTaskList, sizeof( pxOverflowDelayedTaskList ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xPendingReadyList, sizeof( xPendingReadyList ) );
+
+        #if ( INCLUDE_vTaskDelete == 1 )
+        {
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xTasksWaitingTermination, sizeof( xTasksWaitingTermination ) );
+        }
+        #endif
+
+        #if ( INCLUDE_vTaskSuspend == 1 )
+        {
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xSuspendedTaskList, sizeof( xSuspendedTaskList ) );
+        }
+        #endif
+
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &uxCurrentNumberOfTasks, sizeof( uxCurrentNumberOfTasks ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &xTickCount, sizeof( xTickCount ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &uxTopReadyPriority, sizeof( uxTopReadyPriority ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &xSchedulerRunning, sizeof( xSchedulerRunning ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &xPendedTicks, sizeof( xPendedTicks ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) xYieldPendings, sizeof( xYieldPendings ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &xNumOfOverflows, sizeof( xNumOfOverflows ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &xNextTaskUnblockTime, sizeof( xNextTaskUnblockTime ) );
+        vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, ( const void * ) &uxSchedulerSuspended, sizeof( uxSchedulerSuspended ) );
+    }
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+    static void prvSnapshotWriteTasksWithinList( SnapshotWriter_t * pxWriter,
+                                                 const List_t * pxList,
+                                                 eTaskState eState )
+    {
+        const ListItem_t * pxListItem = listGET_HEAD_ENTRY( pxList );
+        const ListItem_t * const pxListEnd = listGET_END_MARKER( pxList );
+        UBaseType_t uxRemaining = listCURRENT_LIST_LENGTH( pxList );
+        const TCB_t * pxTCB;
+        portPOINTER_SIZE_TYPE uxHandle;
+        uint32_t ulState;
+
+        /* The walk is bounded by the length of the list, so a corrupted list
+         * cannot be followed indefinitely. */
+        while( ( pxListItem != pxListEnd ) && ( pxListItem != NULL ) && ( uxRemaining > ( UBaseType_t ) 0U ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxListItem );
+
+            /* A list item without an owner can only be found in a corrupted
+             * list, so nothing after it can be trusted. */
+            if( pxTCB == NULL )
+            {
+                break;
+            }
+
+            uxHandle = ( portPOINTER_SIZE_TYPE ) pxTCB;
+
+            if( taskTASK_IS_RUNNING( pxTCB ) != pdFALSE )
+            {
+                ulState = ( uint32_t ) eRunning;
+            }
+            else if( ( eState == eSuspended ) && ( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL ) )
+            {
+                /* Tasks waiting for an event without a timeout are held in
+                 * the Suspended list, as in eTaskGetState(). */
+                ulState = ( uint32_t ) eBlocked;
+            }
+            else
+            {
+                ulState = ( uint32_t ) eState;
+            }
+
+            if( prvSnapshotBeginRecord( pxWriter, tskSNAPSHOT_RECORD_TASK, sizeof( uxHandle ) + sizeof( ulState ) ) != pdFALSE )
+            {
+                prvSnapshotWrite( pxWriter, &uxHandle, sizeof( uxHandle ) );
+                prvSnapshotWrite( pxWriter, &ulState, sizeof( ulState ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_TCB, pxTCB, sizeof( TCB_t ) );
+
+            /* Only the part of the stack that has been used is included, which
+             * requires the end of the stack to be known. */
+            #if ( portSTACK_GROWTH > 0 )
+            {
+                const StackType_t * const pxUsedEnd = pxTCB->pxEndOfStack - prvTaskCheckFreeStackSpace( ( const uint8_t * ) pxTCB->pxEndOfStack );
+
+                if( pxUsedEnd >= pxTCB->pxStack )
+                {
+                    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_STACK, pxTCB->pxStack, ( size_t ) ( ( pxUsedEnd - pxTCB->pxStack ) + 1 ) * sizeof( StackType_t ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #elif ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+            {
+                const StackType_t * const pxUsedStart = pxTCB->pxStack + prvTaskCheckFreeStackSpace( ( const uint8_t * ) pxTCB->pxStack );
+
+                if( pxTCB->pxEndOfStack >= pxUsedStart )
+                {
+                    vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_STACK, pxUsedStart, ( size_t ) ( ( pxTCB->pxEndOfStack - pxUsedStart ) + 1 ) * sizeof( StackType_t ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* if ( portSTACK_GROWTH > 0 ) */
+
+            pxListItem = listGET_NEXT( pxListItem );
+            uxRemaining--;
+        }
+    }
+
+#endif /* #if ( configUSE_KERNEL_SNAPSHOT == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+    void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskSuspend( xTaskToSuspend );
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the running task that is
+             * being suspended. */
+            pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
             configASSERT( pxTCB != NULL );
 
             traceTASK_SUSPEND( pxTCB );
@@ -3674,7 +4868,7 @@ static BaseType_t prvCreateIdleTasks( void )
             #else
             {
                 /* Assign idle task to each core before SMP scheduler is running. */
-                xIdleTaskHandles[ xCoreID ]->xTaskRunState = xCoreID;
+                xIdleTaskHandles[ xCoreID ]->xTaskRunState = ( taskTCB_SIGNED_TYPE ) xCoreID;
                 pxCurrentTCBs[ xCoreID ] = xIdleTaskHandles[ xCoreID ];
             }
             #endif
@@ -3904,7 +5098,7 @@ void vTaskSuspendAll( void )
              * do not otherwise exhibit real time behaviour. */
             portSOFTWARE_BARRIER();
 
-            portGET_TASK_LOCK( xCoreID );
+            taskGET_TASK_LOCK( xCoreID, eLockSiteSuspendAll );
 
             /* uxSchedulerSuspended is increased after prvCheckForRunStateChange. The
              * purpose is to prevent altering the variable when fromISR APIs are readying
@@ -3923,12 +5117,12 @@ void vTaskSuspendAll( void )
              * task lock for the core is acquired in prvCheckForRunStateChange. */
             xCoreID = ( BaseType_t ) portGET_CORE_ID();
 
-            portGET_ISR_LOCK( xCoreID );
+            taskGET_ISR_LOCK( xCoreID, eLockSiteSuspendAll );
 
             /* The scheduler is suspended if uxSchedulerSuspended is non-zero. An increment
              * is used to allow calls to vTaskSuspendAll() to nest. */
             ++uxSchedulerSuspended;
-            portRELEASE_ISR_LOCK( xCoreID );
+            taskRELEASE_ISR_LOCK( xCoreID );
 
             portCLEAR_INTERRUPT_MASK( ulState );
         }
@@ -4033,7 +5227,7 @@ BaseType_t xTaskResumeAll( void )
             configASSERT( uxSchedulerSuspended != 0U );
 
             uxSchedulerSuspended = ( UBaseType_t ) ( uxSchedulerSuspended - 1U );
-            portRELEASE_TASK_LOCK( xCoreID );
+            taskRELEASE_TASK_LOCK( xCoreID );
 
             if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
             {
@@ -4871,7 +6065,12 @@ BaseType_t xTaskIncrementTick( void )
             {
                 if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
                 {
-                    xSwitchRequired = pdTRUE;
+                    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+                        if( prvTimeSliceExpired( pxCurrentTCB ) != pdFALSE )
+                    #endif
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
                 }
                 else
                 {
@@ -4886,7 +6085,12 @@ BaseType_t xTaskIncrementTick( void )
                 {
                     if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ) ) > 1U )
                     {
-                        xYieldPendings[ xCoreID ] = pdTRUE;
+                        #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+                            if( prvTimeSliceExpired( pxCurrentTCBs[ xCoreID ] ) != pdFALSE )
+                        #endif
+                        {
+                            xYieldPendings[ xCoreID ] = pdTRUE;
+                        }
                     }
                     else
                     {
@@ -4932,6 +6136,12 @@ BaseType_t xTaskIncrementTick( void )
                 BaseType_t xCoreID, xCurrentCoreID;
                 xCurrentCoreID = ( BaseType_t ) portGET_CORE_ID();
 
+                #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
+                {
+                    prvCheckPreemptionDisableBudgets();
+                }
+                #endif
+
                 for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
                 {
                     #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
@@ -5146,6 +6356,12 @@ BaseType_t xTaskIncrementTick( void )
                 if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
                 {
                     pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+
+                    #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+                    {
+                        prvChargeFairShareTask( pxCurrentTCB, ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                    }
+                    #endif
                 }
                 else
                 {
@@ -5172,6 +6388,13 @@ BaseType_t xTaskIncrementTick( void )
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
             taskSELECT_HIGHEST_PRIORITY_TASK();
+
+            #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+            {
+                prvSelectFairShareTask();
+            }
+            #endif
+
             traceTASK_SWITCHED_IN();
 
             /* Macro to inject port specific behaviour immediately after
@@ -5202,16 +6425,21 @@ BaseType_t xTaskIncrementTick( void )
     {
         traceENTER_vTaskSwitchContext();
 
-        /* Acquire both locks:
+        /* Acquire both locks, but only hold the ISR lock while the ready lists
+         * are used:
          * - The ISR lock protects the ready list from simultaneous access by
          *   both other ISRs and tasks.
          * - We also take the task lock to pause here in case another core has
          *   suspended the scheduler. We don't want to simply set xYieldPending
          *   and move on if another core suspended the scheduler. We should only
-         *   do that if the current core has suspended the scheduler. */
+         *   do that if the current core has suspended the scheduler.
+         *
+         * The task switched out and the task switched in are only ever changed
+         * by this core, so the bookkeeping for them is done with just the task
+         * lock held.  The task lock is enough to read uxSchedulerSuspended as
+         * it is only written with both locks held. */
 
-        portGET_TASK_LOCK( xCoreID ); /* Must always acquire the task lock first. */
-        portGET_ISR_LOCK( xCoreID );
+        taskGET_TASK_LOCK( xCoreID, eLockSiteSwitchContext ); /* Must always acquire the task lock first. */
         {
             /* vTaskSwitchContext() must never be called from within a critical section.
              * This is not necessarily true for single core FreeRTOS, but it is for this
@@ -5268,7 +6496,12 @@ BaseType_t xTaskIncrementTick( void )
                 #endif
 
                 /* Select a new task to run. */
-                taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
+                taskGET_ISR_LOCK( xCoreID, eLockSiteSwitchContext );
+                {
+                    taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
+                }
+                taskRELEASE_ISR_LOCK( xCoreID );
+
                 traceTASK_SWITCHED_IN();
 
                 /* Macro to inject port specific behaviour immediately after
@@ -5292,8 +6525,7 @@ BaseType_t xTaskIncrementTick( void )
                 #endif
             }
         }
-        portRELEASE_ISR_LOCK( xCoreID );
-        portRELEASE_TASK_LOCK( xCoreID );
+        taskRELEASE_TASK_LOCK( xCoreID );
 
         traceRETURN_vTaskSwitchContext();
     }
@@ -5330,7 +6562,7 @@ void vTaskPlaceOnEventList( List_t * const pxEventList,
 /*-----------------------------------------------------------*/
 
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
+                                     const EventItemValue_t xItemValue,
                                      const TickType_t xTicksToWait )
 {
     traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait );
@@ -5344,7 +6576,19 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
     /* Store the item value in the event list item.  It is safe to access the
      * event list item here as interrupts won't access the event list item of a
      * task that is not in the Blocked state. */
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+    {
+        /* The item value is too wide for the event list item, so is held in
+         * the TCB.  The event list item is still marked as in use so its value
+         * is not overwritten by a priority change. */
+        pxCurrentTCB->xEventItemValue = xItemValue;
+        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    }
+    #else
+    {
+        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    }
+    #endif
 
     /* Place the event list item of the TCB at the end of the appropriate event
      * list.  It is safe to access the event list here because it is part of an
@@ -5492,7 +6736,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
 /*-----------------------------------------------------------*/
 
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue )
+                                        const EventItemValue_t xItemValue )
 {
     TCB_t * pxUnblockedTCB;
 
@@ -5502,9 +6746,6 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
      * the event flags implementation. */
     configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
 
-    /* Store the new item value in the event list. */
-    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
-
     /* Remove the event list form the event flag.  Interrupts do not access
      * event flags. */
     /* MISRA Ref 11.5.3 [Void pointer assignment] */
@@ -5512,6 +6753,18 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     /* coverity[misra_c_2012_rule_11_5_violation] */
     pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
     configASSERT( pxUnblockedTCB );
+
+    /* Store the new item value in the event list. */
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+    {
+        pxUnblockedTCB->xEventItemValue = xItemValue;
+        listSET_LIST_ITEM_VALUE( pxEventListItem, taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    }
+    #else
+    {
+        listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    }
+    #endif
     listREMOVE_ITEM( pxEventListItem );
 
     #if ( configUSE_TICKLESS_IDLE != 0 )
@@ -5553,14 +6806,111 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
             {
                 prvYieldForTask( pxUnblockedTCB );
             }
-            taskEXIT_CRITICAL();
+            taskEXIT_CRITICAL();
+        }
+        #endif
+    }
+    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+
+    traceRETURN_vTaskRemoveFromUnorderedEventList();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 )
+
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const EventItemValue_t xItemValue )
+    {
+        TCB_t * pxUnblockedTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue );
+
+        /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+         * called from a critical section within an ISR.  It is used by the event
+         * groups implementation, which only accesses its event lists from
+         * within critical sections when configUSE_EVENT_GROUPS_DIRECT_ISR is 1. */
+
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+        configASSERT( pxUnblockedTCB );
+
+        /* Store the new item value in the event list. */
+        #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+        {
+            pxUnblockedTCB->xEventItemValue = xItemValue;
+            listSET_LIST_ITEM_VALUE( pxEventListItem, taskEVENT_LIST_ITEM_VALUE_IN_USE );
+        }
+        #else
+        {
+            listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+        }
+        #endif
+
+        listREMOVE_ITEM( pxEventListItem );
+
+        if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+        {
+            listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+            prvAddTaskToReadyList( pxUnblockedTCB );
+
+            #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                /* See the comment in xTaskRemoveFromEventList(). */
+                prvResetNextTaskUnblockTime();
+            }
+            #endif
+        }
+        else
+        {
+            /* The delayed and ready lists cannot be accessed, so hold this task
+             * pending until the scheduler is resumed.  The value of the event
+             * list item is not changed by placing it in the pending ready
+             * list. */
+            listINSERT_END( &( xPendingReadyList ), pxEventListItem );
+        }
+
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+            {
+                /* Return true if the task removed from the event list has a
+                 * higher priority than the interrupted task, and mark that a
+                 * yield is pending in case the caller does not use the return
+                 * value. */
+                xReturn = pdTRUE;
+                xYieldPendings[ 0 ] = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
+        }
+        #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+        {
+            xReturn = pdFALSE;
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                prvYieldForTask( pxUnblockedTCB );
+
+                if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                }
+            }
+            #endif /* #if ( configUSE_PREEMPTION == 1 ) */
         }
-        #endif
+        #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+
+        traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn );
+
+        return xReturn;
     }
-    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 
-    traceRETURN_vTaskRemoveFromUnorderedEventList();
-}
+#endif /* #if ( configUSE_EVENT_GROUPS_DIRECT_ISR == 1 ) */
 /*-----------------------------------------------------------*/
 
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
@@ -5789,6 +7139,12 @@ void vTaskMissedYield( void )
                 vApplicationPassiveIdleHook();
             }
             #endif /* configUSE_PASSIVE_IDLE_HOOK */
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                portPASSIVE_IDLE_WAIT();
+            }
+            #endif /* configUSE_PREEMPTION */
         }
     }
 #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
@@ -5807,6 +7163,10 @@ void vTaskMissedYield( void )
 
 static portTASK_FUNCTION( prvIdleTask, pvParameters )
 {
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        TickType_t xLastDeadlockCheckTime = ( TickType_t ) 0U;
+    #endif
+
     /* Stop warnings. */
     ( void ) pvParameters;
 
@@ -5872,6 +7232,23 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         }
         #endif /* configUSE_IDLE_HOOK */
 
+        #if ( configUSE_DEADLOCK_DETECTION == 1 )
+        {
+            /* configDEADLOCK_DETECTION_PERIOD may be defined using a cast, so
+             * is tested here rather than by the preprocessor. */
+            if( ( ( TickType_t ) configDEADLOCK_DETECTION_PERIOD != ( TickType_t ) 0U ) &&
+                ( ( xTaskGetTickCount() - xLastDeadlockCheckTime ) >= ( TickType_t ) configDEADLOCK_DETECTION_PERIOD ) )
+            {
+                xLastDeadlockCheckTime = xTaskGetTickCount();
+                vTaskCheckForDeadlocks();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_DEADLOCK_DETECTION */
+
         /* This conditional compilation should use inequality to 0, not equality
          * to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
          * user defined low power mode  implementations require
@@ -6284,239 +7661,664 @@ static void prvCheckTasksWaitingTermination( void )
                 }
                 #endif /* INCLUDE_vTaskSuspend */
 
-                /* Tasks can be in pending ready list and other state list at the
-                 * same time. These tasks are in ready state no matter what state
-                 * list the task is in. */
-                taskENTER_CRITICAL();
-                {
-                    if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) != pdFALSE )
-                    {
-                        pxTaskStatus->eCurrentState = eReady;
-                    }
-                }
-                taskEXIT_CRITICAL();
+                /* Tasks can be in pending ready list and other state list at the
+                 * same time. These tasks are in ready state no matter what state
+                 * list the task is in. */
+                taskENTER_CRITICAL();
+                {
+                    if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) != pdFALSE )
+                    {
+                        pxTaskStatus->eCurrentState = eReady;
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+        }
+        else
+        {
+            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+        }
+
+        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+         * parameter is provided to allow it to be skipped. */
+        if( xGetFreeStackSpace != pdFALSE )
+        {
+            #if ( portSTACK_GROWTH > 0 )
+            {
+                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+            }
+            #else
+            {
+                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+            }
+            #endif
+        }
+        else
+        {
+            pxTaskStatus->usStackHighWaterMark = 0;
+        }
+
+        traceRETURN_vTaskGetInfo();
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+                                                     List_t * pxList,
+                                                     eTaskState eState )
+    {
+        UBaseType_t uxTask = 0;
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxList );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB = NULL;
+
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        {
+            /* Populate an TaskStatus_t structure within the
+             * pxTaskStatusArray array for each task that is referenced from
+             * pxList.  See the definition of TaskStatus_t in task.h for the
+             * meaning of each TaskStatus_t structure member. */
+            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+                uxTask++;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxTask;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_KERNEL_SNAPSHOT == 1 ) )
+
+    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    {
+        configSTACK_DEPTH_TYPE uxCount = 0U;
+
+        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        {
+            pucStackByte -= portSTACK_GROWTH;
+            uxCount++;
+        }
+
+        uxCount /= ( configSTACK_DEPTH_TYPE ) sizeof( StackType_t );
+
+        return uxCount;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configUSE_KERNEL_SNAPSHOT == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+ * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+ * user to determine the return type.  It gets around the problem of the value
+ * overflowing on 8-bit types without breaking backward compatibility for
+ * applications that expect an 8-bit return type. */
+    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        configSTACK_DEPTH_TYPE uxReturn;
+
+        traceENTER_uxTaskGetStackHighWaterMark2( xTask );
+
+        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
+         * allows the user to determine the return type.  It gets around the
+         * problem of the value overflowing on 8-bit types without breaking
+         * backward compatibility for applications that expect an 8-bit return
+         * type. */
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        #if portSTACK_GROWTH < 0
+        {
+            pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+        }
+        #else
+        {
+            pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+        }
+        #endif
+
+        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        traceRETURN_uxTaskGetStackHighWaterMark2( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        uint8_t * pucEndOfStack;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxTaskGetStackHighWaterMark( xTask );
+
+        pxTCB = prvGetTCBFromHandle( xTask );
+        configASSERT( pxTCB != NULL );
+
+        #if portSTACK_GROWTH < 0
+        {
+            pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+        }
+        #else
+        {
+            pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+        }
+        #endif
+
+        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+        traceRETURN_uxTaskGetStackHighWaterMark( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+    static void prvDeleteTCB( TCB_t * pxTCB )
+    {
+        /* This call is required specifically for the TriCore port.  It must be
+         * above the vPortFree() calls.  The call is also used by ports/demos that
+         * want to allocate and clean RAM statically. */
+        portCLEAN_UP_TCB( pxTCB );
+
+        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        {
+            /* Free up the memory allocated for the task's TLS Block. */
+            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
+        }
+        #endif
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        {
+            /* The task can only have been allocated dynamically - free both
+             * the stack and TCB. */
+            vPortFreeStack( pxTCB->pxStack );
+            vPortFree( pxTCB );
+        }
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+        {
+            /* The task could have been allocated statically or dynamically, so
+             * check what was statically allocated before trying to free the
+             * memory. */
+            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            {
+                /* Both the stack and TCB were allocated dynamically, so both
+                 * must be freed. */
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
+            }
+            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            {
+                /* Only the stack was statically allocated, so the TCB is the
+                 * only memory that must be freed. */
+                vPortFree( pxTCB );
+            }
+            else
+            {
+                /* Neither the stack nor the TCB were allocated dynamically, so
+                 * nothing needs to be freed. */
+                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+    }
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+    static void prvAddTaskToFairShareReadyList( TCB_t * const pxTCB )
+    {
+        List_t * const pxReadyList = &( pxReadyTasksLists[ configFAIR_SHARE_PRIORITY ] );
+        ListItem_t * pxIterator;
+        const ListItem_t * pxEndMarker;
+        TickType_t xRebase;
+
+        /* Bound the time spent below, which is within a critical section and
+         * can be within an interrupt. */
+        configASSERT( listCURRENT_LIST_LENGTH( pxReadyList ) < ( UBaseType_t ) configFAIR_SHARE_MAX_READY_TASKS );
+
+        /* A task that has been blocked keeps the virtual run time it had, so
+         * it is selected ahead of tasks that used the processor while it was
+         * blocked, but it cannot build up credit beyond the least virtual run
+         * time of the class.  Otherwise it could then starve the other tasks. */
+        if( ( TickType_t ) ( pxTCB->xVirtualRunTime - xFairShareMinVirtualRunTime ) > taskFAIR_SHARE_MAX_LEAD )
+        {
+            pxTCB->xVirtualRunTime = xFairShareMinVirtualRunTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( TickType_t ) ( pxTCB->xVirtualRunTime - xFairShareBaseVirtualRunTime ) > taskFAIR_SHARE_REBASE_LIMIT )
+        {
+            /* Move the base up to the least virtual run time.  No ready task
+             * has a lower virtual run time, so the relative values all remain
+             * positive and in the same order. */
+            xRebase = xFairShareMinVirtualRunTime - xFairShareBaseVirtualRunTime;
+            pxEndMarker = listGET_END_MARKER( pxReadyList );
+
+            for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+            {
+                listSET_LIST_ITEM_VALUE( pxIterator, listGET_LIST_ITEM_VALUE( pxIterator ) - xRebase );
             }
+
+            xFairShareBaseVirtualRunTime = xFairShareMinVirtualRunTime;
         }
         else
         {
-            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-         * parameter is provided to allow it to be skipped. */
-        if( xGetFreeStackSpace != pdFALSE )
+        /* Tasks with equal virtual run times are inserted after each other, so
+         * they are selected in the order they became ready. */
+        listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xVirtualRunTime - xFairShareBaseVirtualRunTime );
+        vListInsert( pxReadyList, &( pxTCB->xStateListItem ) );
+    }
+
+#endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+    static void prvChargeFairShareTask( TCB_t * const pxTCB,
+                                        configRUN_TIME_COUNTER_TYPE ulRunTime )
+    {
+        const configRUN_TIME_COUNTER_TYPE ulWeight = ( configRUN_TIME_COUNTER_TYPE ) pxTCB->uxFairShareWeight;
+        const configRUN_TIME_COUNTER_TYPE ulDefaultWeight = ( configRUN_TIME_COUNTER_TYPE ) tskDEFAULT_FAIR_SHARE_WEIGHT;
+        configRUN_TIME_COUNTER_TYPE ulScaledRemainder;
+
+        if( pxTCB->uxPriority == ( UBaseType_t ) configFAIR_SHARE_PRIORITY )
         {
-            #if ( portSTACK_GROWTH > 0 )
+            /* Scale the run time by ( default weight / task weight ), so a task
+             * with twice the default weight accumulates virtual run time at half
+             * the rate, and so receives twice the processor time.  The scaling
+             * is split so the multiplication cannot overflow, and the remainder
+             * is carried forward as the run time charged at each context switch
+             * can be smaller than the weight. */
+            ulScaledRemainder = ( ( ulRunTime % ulWeight ) * ulDefaultWeight ) + ( configRUN_TIME_COUNTER_TYPE ) pxTCB->uxFairShareCarry;
+            pxTCB->xVirtualRunTime += ( TickType_t ) ( ( ( ulRunTime / ulWeight ) * ulDefaultWeight ) + ( ulScaledRemainder / ulWeight ) );
+            pxTCB->uxFairShareCarry = ( UBaseType_t ) ( ulScaledRemainder % ulWeight );
+
+            if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configFAIR_SHARE_PRIORITY ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
             {
-                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+                /* The task is still ready, so move it to its new position.
+                 * The list cannot become empty, so the ready priority does not
+                 * need to be reset. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                prvAddTaskToFairShareReadyList( pxTCB );
             }
-            #else
+            else
             {
-                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+                mtCOVERAGE_TEST_MARKER();
             }
-            #endif
         }
         else
         {
-            pxTaskStatus->usStackHighWaterMark = 0;
+            mtCOVERAGE_TEST_MARKER();
         }
+    }
 
-        traceRETURN_vTaskGetInfo();
+#endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAIR_SHARE_SCHEDULING == 1 )
+
+    static void prvSelectFairShareTask( void )
+    {
+        List_t * const pxReadyList = &( pxReadyTasksLists[ configFAIR_SHARE_PRIORITY ] );
+
+        if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configFAIR_SHARE_PRIORITY )
+        {
+            /* The list is ordered by virtual run time, so the task at its head
+             * has received the least processor time relative to its weight. */
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxCurrentTCB = listGET_OWNER_OF_HEAD_ENTRY( pxReadyList );
+            xFairShareMinVirtualRunTime = pxCurrentTCB->xVirtualRunTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* #if ( configUSE_FAIR_SHARE_SCHEDULING == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
 
-    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
-                                                     List_t * pxList,
-                                                     eTaskState eState )
+    static BaseType_t prvTaskIsWaiting( const TCB_t * pxTCB )
     {
-        UBaseType_t uxTask = 0;
-        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxList );
-        ListItem_t * pxIterator;
-        TCB_t * pxTCB = NULL;
+        BaseType_t xReturn = pdFALSE;
+        const List_t * const pxEventList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        /* A task that was readied while the scheduler was suspended remains in
+         * the Blocked list until the scheduler is resumed, but is held in the
+         * pending ready list in place of the event list it was waiting on. */
+        if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) )
         {
-            /* Populate an TaskStatus_t structure within the
-             * pxTaskStatusArray array for each task that is referenced from
-             * pxList.  See the definition of TaskStatus_t in task.h for the
-             * meaning of each TaskStatus_t structure member. */
-            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
             {
-                /* MISRA Ref 11.5.3 [Void pointer assignment] */
-                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+                BaseType_t x;
 
-                vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-                uxTask++;
+                for( x = 0; ( x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES ) && ( xReturn == pdFALSE ); x++ )
+                {
+                    if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                    {
+                        xReturn = pdTRUE;
+                    }
+                }
             }
+            #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
+
+    static TCB_t * prvGetBlockingMutexHolder( const TCB_t * pxTCB )
+    {
+        TCB_t * pxHolder = NULL;
+
+        /* pvBlockingMutex is only cleared once the task runs again, so it is
+         * only valid while the task is still waiting. */
+        if( ( pxTCB->pvBlockingMutex != NULL ) && ( prvTaskIsWaiting( pxTCB ) != pdFALSE ) )
+        {
+            pxHolder = *( pxTCB->pxBlockingMutexHolder );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        return uxTask;
+        return pxHolder;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
 
-    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    static UBaseType_t prvGetWaitChain( TCB_t * pxTCB,
+                                        TickType_t xTimeNow,
+                                        TaskWaitLink_t * pxChain,
+                                        BaseType_t * pxDeadlocked )
     {
-        configSTACK_DEPTH_TYPE uxCount = 0U;
+        TCB_t * pxLink = pxTCB;
+        TCB_t * pxHolder;
+        UBaseType_t uxLength = 0U;
 
-        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        *pxDeadlocked = pdFALSE;
+
+        /* The chain is bounded, so a cycle that does not include pxTCB, which
+         * will be reported when its own tasks are checked, does not prevent
+         * the walk ending. */
+        do
         {
-            pucStackByte -= portSTACK_GROWTH;
-            uxCount++;
-        }
+            pxHolder = prvGetBlockingMutexHolder( pxLink );
 
-        uxCount /= ( configSTACK_DEPTH_TYPE ) sizeof( StackType_t );
+            pxChain[ uxLength ].xTask = pxLink;
+            pxChain[ uxLength ].pvMutex = ( pxHolder != NULL ) ? pxLink->pvBlockingMutex : NULL;
 
-        return uxCount;
+            if( prvTaskIsWaiting( pxLink ) != pdFALSE )
+            {
+                pxChain[ uxLength ].xTicksBlocked = xTimeNow - pxLink->xBlockedSince;
+            }
+            else
+            {
+                pxChain[ uxLength ].xTicksBlocked = ( TickType_t ) 0U;
+            }
+
+            uxLength++;
+
+            if( pxHolder == pxTCB )
+            {
+                *pxDeadlocked = pdTRUE;
+                pxLink = NULL;
+            }
+            else
+            {
+                pxLink = pxHolder;
+            }
+        } while( ( pxLink != NULL ) && ( uxLength < ( UBaseType_t ) configDEADLOCK_DETECTION_MAX_CHAIN_LENGTH ) );
+
+        return uxLength;
     }
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+#if ( configUSE_DEADLOCK_DETECTION == 1 )
 
-/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
- * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
- * user to determine the return type.  It gets around the problem of the value
- * overflowing on 8-bit types without breaking backward compatibility for
- * applications that expect an 8-bit return type. */
-    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+    static void prvCheckListForDeadlocks( const List_t * pxList,
+                                          TickType_t xTimeNow,
+                                          TaskWaitLink_t * pxChain )
     {
+        const ListItem_t * pxListItem;
+        const ListItem_t * const pxListEnd = listGET_END_MARKER( pxList );
         TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        configSTACK_DEPTH_TYPE uxReturn;
+        UBaseType_t uxLength;
+        UBaseType_t x;
+        BaseType_t xDeadlocked;
 
-        traceENTER_uxTaskGetStackHighWaterMark2( xTask );
+        for( pxListItem = listGET_HEAD_ENTRY( pxList ); pxListItem != pxListEnd; pxListItem = listGET_NEXT( pxListItem ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxListItem );
 
-        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
-         * allows the user to determine the return type.  It gets around the
-         * problem of the value overflowing on 8-bit types without breaking
-         * backward compatibility for applications that expect an 8-bit return
-         * type. */
+            /* Only tasks waiting for an event are checked, not tasks that are
+             * delayed or suspended. */
+            if( prvTaskIsWaiting( pxTCB ) != pdFALSE )
+            {
+                if( ( ( pxTCB->ucBlockingReported & taskMUTEX_DEADLOCK_REPORTED ) == 0U ) &&
+                    ( prvGetBlockingMutexHolder( pxTCB ) != NULL ) )
+                {
+                    uxLength = prvGetWaitChain( pxTCB, xTimeNow, pxChain, &xDeadlocked );
 
-        pxTCB = prvGetTCBFromHandle( xTask );
-        configASSERT( pxTCB != NULL );
+                    if( xDeadlocked != pdFALSE )
+                    {
+                        /* Mark every task in the cycle, so the cycle is not
+                         * reported again when the other tasks in it are
+                         * checked. */
+                        for( x = 0U; x < uxLength; x++ )
+                        {
+                            pxChain[ x ].xTask->ucBlockingReported |= taskMUTEX_DEADLOCK_REPORTED;
+                        }
 
-        #if portSTACK_GROWTH < 0
+                        vApplicationDeadlockHook( eMutexDeadlock, pxChain, uxLength );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( ( pxTCB->xBlockTimeLimit != ( TickType_t ) 0U ) &&
+                    ( ( pxTCB->ucBlockingReported & taskBLOCK_TIME_LIMIT_REPORTED ) == 0U ) &&
+                    ( ( xTimeNow - pxTCB->xBlockedSince ) >= pxTCB->xBlockTimeLimit ) )
+                {
+                    uxLength = prvGetWaitChain( pxTCB, xTimeNow, pxChain, &xDeadlocked );
+                    pxTCB->ucBlockingReported |= taskBLOCK_TIME_LIMIT_REPORTED;
+
+                    vApplicationDeadlockHook( eBlockTimeLimitExceeded, pxChain, uxLength );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+#endif /* #if ( configUSE_DEADLOCK_DETECTION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_SLICE_LENGTH == 1 )
+
+    static BaseType_t prvTimeSliceExpired( TCB_t * const pxTCB )
+    {
+        BaseType_t xReturn;
+
+        if( pxTCB->xTimeSliceRemaining > ( TickType_t ) 1U )
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            pxTCB->xTimeSliceRemaining--;
+            xReturn = pdFALSE;
         }
-        #else
+        else
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            pxTCB->xTimeSliceRemaining = pxTCB->xTimeSliceLength;
+            xReturn = pdTRUE;
         }
-        #endif
-
-        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
-
-        traceRETURN_uxTaskGetStackHighWaterMark2( uxReturn );
 
-        return uxReturn;
+        return xReturn;
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+#endif /* #if ( configUSE_TIME_SLICE_LENGTH == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
 
-    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    static void prvEndPreemptionDisableWindow( TCB_t * const pxTCB )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        UBaseType_t uxReturn;
+        const TickType_t xConstTickCount = xTickCount;
+        TickType_t xElapsed;
 
-        traceENTER_uxTaskGetStackHighWaterMark( xTask );
+        ( xPreemptionDisableStatistics.uxWindows )++;
 
-        pxTCB = prvGetTCBFromHandle( xTask );
-        configASSERT( pxTCB != NULL );
+        xElapsed = xConstTickCount - pxTCB->xPreemptionDisabledTime;
 
-        #if portSTACK_GROWTH < 0
+        if( xElapsed > xPreemptionDisableStatistics.xLongestWindow )
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            xPreemptionDisableStatistics.xLongestWindow = xElapsed;
         }
-        #else
+        else
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif
 
-        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+        if( pxTCB->xPreemptionDeferred != pdFALSE )
+        {
+            xElapsed = xConstTickCount - pxTCB->xPreemptionDeferredTime;
 
-        traceRETURN_uxTaskGetStackHighWaterMark( uxReturn );
+            ( xPreemptionDisableStatistics.uxDelayedPreemptions )++;
+            xPreemptionDisableStatistics.xTotalPreemptionDelay += xElapsed;
 
-        return uxReturn;
+            if( xElapsed > xPreemptionDisableStatistics.xLongestPreemptionDelay )
+            {
+                xPreemptionDisableStatistics.xLongestPreemptionDelay = xElapsed;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->xPreemptionDeferred = pdFALSE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTCB->xPreemptionBudgetOverrun = pdFALSE;
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+#endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 )
 
-    static void prvDeleteTCB( TCB_t * pxTCB )
+    static void prvCheckPreemptionDisableBudgets( void )
     {
-        /* This call is required specifically for the TriCore port.  It must be
-         * above the vPortFree() calls.  The call is also used by ports/demos that
-         * want to allocate and clean RAM statically. */
-        portCLEAN_UP_TCB( pxTCB );
+        TCB_t * pxTCB;
+        BaseType_t xCoreID;
 
-        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
         {
-            /* Free up the memory allocated for the task's TLS Block. */
-            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
-        }
-        #endif
+            pxTCB = pxCurrentTCBs[ xCoreID ];
 
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
-        {
-            /* The task can only have been allocated dynamically - free both
-             * the stack and TCB. */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
-        }
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
-        {
-            /* The task could have been allocated statically or dynamically, so
-             * check what was statically allocated before trying to free the
-             * memory. */
-            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
-            {
-                /* Both the stack and TCB were allocated dynamically, so both
-                 * must be freed. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
-            }
-            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            /* Each window is reported at most once. */
+            if( ( pxTCB->xPreemptionDisable != pdFALSE ) &&
+                ( pxTCB->xPreemptionBudgetOverrun == pdFALSE ) &&
+                ( pxTCB->xPreemptionDisableBudget > ( TickType_t ) 0U ) &&
+                ( ( xTickCount - pxTCB->xPreemptionDisabledTime ) > pxTCB->xPreemptionDisableBudget ) )
             {
-                /* Only the stack was statically allocated, so the TCB is the
-                 * only memory that must be freed. */
-                vPortFree( pxTCB );
+                pxTCB->xPreemptionBudgetOverrun = pdTRUE;
+                ( xPreemptionDisableStatistics.uxOverruns )++;
+                traceTASK_PREEMPTION_DISABLE_OVERRUN( pxTCB );
+
+                if( xApplicationPreemptionDisableOverrunHook( pxTCB ) != pdFALSE )
+                {
+                    /* Enable preemption as vTaskPreemptionEnable() would.  The
+                     * caller yields the core. */
+                    prvEndPreemptionDisableWindow( pxTCB );
+                    pxTCB->xPreemptionDisable = pdFALSE;
+                    xYieldPendings[ xCoreID ] = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
             else
             {
-                /* Neither the stack nor the TCB were allocated dynamically, so
-                 * nothing needs to be freed. */
-                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
     }
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* #if ( configUSE_PREEMPTION_DISABLE_BUDGET == 1 ) */
 /*-----------------------------------------------------------*/
 
 static void prvResetNextTaskUnblockTime( void )
@@ -6887,7 +8689,7 @@ static void prvResetNextTaskUnblockTime( void )
                      * state. */
                     traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
                     uxPriorityUsedOnEntry = pxTCB->uxPriority;
-                    pxTCB->uxPriority = uxPriorityToUse;
+                    pxTCB->uxPriority = ( taskTCB_UNSIGNED_TYPE ) uxPriorityToUse;
 
                     /* Only reset the event list item value if the value is not
                      * being used for anything else. */
@@ -7039,8 +8841,8 @@ static void prvResetNextTaskUnblockTime( void )
             {
                 if( portGET_CRITICAL_NESTING_COUNT( xCoreID ) == 0U )
                 {
-                    portGET_TASK_LOCK( xCoreID );
-                    portGET_ISR_LOCK( xCoreID );
+                    taskGET_TASK_LOCK( xCoreID, eLockSiteEnterCritical );
+                    taskGET_ISR_LOCK( xCoreID, eLockSiteEnterCritical );
                 }
 
                 portINCREMENT_CRITICAL_NESTING_COUNT( xCoreID );
@@ -7093,7 +8895,7 @@ static void prvResetNextTaskUnblockTime( void )
 
             if( portGET_CRITICAL_NESTING_COUNT( xCoreID ) == 0U )
             {
-                portGET_ISR_LOCK( xCoreID );
+                taskGET_ISR_LOCK( xCoreID, eLockSiteEnterCriticalFromISR );
             }
 
             portINCREMENT_CRITICAL_NESTING_COUNT( xCoreID );
@@ -7185,8 +8987,8 @@ static void prvResetNextTaskUnblockTime( void )
                     /* Get the xYieldPending stats inside the critical section. */
                     xYieldCurrentTask = xYieldPendings[ xCoreID ];
 
-                    portRELEASE_ISR_LOCK( xCoreID );
-                    portRELEASE_TASK_LOCK( xCoreID );
+                    taskRELEASE_ISR_LOCK( xCoreID );
+                    taskRELEASE_TASK_LOCK( xCoreID );
                     portENABLE_INTERRUPTS();
 
                     /* When a task yields in a critical section it just sets
@@ -7241,7 +9043,7 @@ static void prvResetNextTaskUnblockTime( void )
 
                 if( portGET_CRITICAL_NESTING_COUNT( xCoreID ) == 0U )
                 {
-                    portRELEASE_ISR_LOCK( xCoreID );
+                    taskRELEASE_ISR_LOCK( xCoreID );
                     portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
                 }
                 else
@@ -7265,6 +9067,50 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+    void vTaskGetLockStatistics( eLockSite eSite,
+                                 eKernelLock eLock,
+                                 LockStatistics_t * pxLockStatistics )
+    {
+        traceENTER_vTaskGetLockStatistics( eSite, eLock, pxLockStatistics );
+
+        configASSERT( ( UBaseType_t ) eSite < taskNUMBER_OF_LOCK_SITES );
+        configASSERT( ( UBaseType_t ) eLock < taskNUMBER_OF_KERNEL_LOCKS );
+        configASSERT( pxLockStatistics != NULL );
+
+        /* The statistics of each lock are updated while the lock is held, and
+         * a critical section holds both locks. */
+        taskENTER_CRITICAL();
+        {
+            *pxLockStatistics = xLockStatistics[ eSite ][ eLock ];
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskGetLockStatistics();
+    }
+
+#endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+
+    void vTaskResetLockStatistics( void )
+    {
+        traceENTER_vTaskResetLockStatistics();
+
+        taskENTER_CRITICAL();
+        {
+            ( void ) memset( ( void * ) xLockStatistics, 0x00, sizeof( xLockStatistics ) );
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskResetLockStatistics();
+    }
+
+#endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
     static char * prvWriteNameToBuffer( char * pcBuffer,
@@ -7292,6 +9138,391 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    static size_t prvWriteTaskListRow( char * pcBuffer,
+                                       size_t uxBufferLength,
+                                       const TaskStatus_t * pxTaskStatus,
+                                       BaseType_t * pxBufferFull )
+    {
+        size_t uxConsumedBufferLength = 0;
+        int iSnprintfReturnValue;
+        char cStatus;
+
+        switch( pxTaskStatus->eCurrentState )
+        {
+            case eRunning:
+                cStatus = tskRUNNING_CHAR;
+                break;
+
+            case eReady:
+                cStatus = tskREADY_CHAR;
+                break;
+
+            case eBlocked:
+                cStatus = tskBLOCKED_CHAR;
+                break;
+
+            case eSuspended:
+                cStatus = tskSUSPENDED_CHAR;
+                break;
+
+            case eDeleted:
+                cStatus = tskDELETED_CHAR;
+                break;
+
+            case eInvalid: /* Fall through. */
+            default:       /* Should not get here, but it is included
+                            * to prevent static checking errors. */
+                cStatus = ( char ) 0x00;
+                break;
+        }
+
+        /* Is there enough space in the buffer to hold task name? */
+        if( configMAX_TASK_NAME_LEN <= uxBufferLength )
+        {
+            /* Write the task name to the string, padding with spaces so it
+             * can be printed in tabular form more easily. */
+            pcBuffer = prvWriteNameToBuffer( pcBuffer, pxTaskStatus->pcTaskName );
+            /* Do not count the terminating null character. */
+            uxConsumedBufferLength = configMAX_TASK_NAME_LEN - 1U;
+
+            /* Is there space left in the buffer? -1 is done because snprintf
+             * writes a terminating null character. So we are essentially
+             * checking if the buffer has space to write at least one non-null
+             * character. */
+            if( uxConsumedBufferLength < ( uxBufferLength - 1U ) )
+            {
+                /* Write the rest of the string. */
+                #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+                    /* MISRA Ref 21.6.1 [snprintf for utility] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                    /* coverity[misra_c_2012_rule_21_6_violation] */
+                    iSnprintfReturnValue = snprintf( pcBuffer,
+                                                     uxBufferLength - uxConsumedBufferLength,
+                                                     "\t%c\t%u\t%u\t%u\t0x%x\r\n",
+                                                     cStatus,
+                                                     ( unsigned int ) pxTaskStatus->uxCurrentPriority,
+                                                     ( unsigned int ) pxTaskStatus->usStackHighWaterMark,
+                                                     ( unsigned int ) pxTaskStatus->xTaskNumber,
+                                                     ( unsigned int ) pxTaskStatus->uxCoreAffinityMask );
+                #else /* ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) ) */
+                    /* MISRA Ref 21.6.1 [snprintf for utility] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                    /* coverity[misra_c_2012_rule_21_6_violation] */
+                    iSnprintfReturnValue = snprintf( pcBuffer,
+                                                     uxBufferLength - uxConsumedBufferLength,
+                                                     "\t%c\t%u\t%u\t%u\r\n",
+                                                     cStatus,
+                                                     ( unsigned int ) pxTaskStatus->uxCurrentPriority,
+                                                     ( unsigned int ) pxTaskStatus->usStackHighWaterMark,
+                                                     ( unsigned int ) pxTaskStatus->xTaskNumber );
+                #endif /* ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) ) */
+                uxConsumedBufferLength += prvSnprintfReturnValueToCharsWritten( iSnprintfReturnValue, uxBufferLength - uxConsumedBufferLength );
+            }
+            else
+            {
+                *pxBufferFull = pdTRUE;
+            }
+        }
+        else
+        {
+            *pxBufferFull = pdTRUE;
+        }
+
+        return uxConsumedBufferLength;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+
+    static size_t prvWriteRunTimeStatsRow( char * pcBuffer,
+                                           size_t uxBufferLength,
+                                           const TaskStatus_t * pxTaskStatus,
+                                           configRUN_TIME_COUNTER_TYPE ulTotalTime,
+                                           BaseType_t * pxBufferFull )
+    {
+        size_t uxConsumedBufferLength = 0;
+        int iSnprintfReturnValue;
+        configRUN_TIME_COUNTER_TYPE ulStatsAsPercentage;
+
+        /* What percentage of the total run time has the task used?
+         * This will always be rounded down to the nearest integer.
+         * ulTotalTime has already been divided by 100. */
+        ulStatsAsPercentage = pxTaskStatus->ulRunTimeCounter / ulTotalTime;
+
+        /* Is there enough space in the buffer to hold task name? */
+        if( configMAX_TASK_NAME_LEN <= uxBufferLength )
+        {
+            /* Write the task name to the string, padding with
+             * spaces so it can be printed in tabular form more
+             * easily. */
+            pcBuffer = prvWriteNameToBuffer( pcBuffer, pxTaskStatus->pcTaskName );
+            /* Do not count the terminating null character. */
+            uxConsumedBufferLength = configMAX_TASK_NAME_LEN - 1U;
+
+            /* Is there space left in the buffer? -1 is done because snprintf
+             * writes a terminating null character. So we are essentially
+             * checking if the buffer has space to write at least one non-null
+             * character. */
+            if( uxConsumedBufferLength < ( uxBufferLength - 1U ) )
+            {
+                if( ulStatsAsPercentage > 0U )
+                {
+                    #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+                    {
+                        /* MISRA Ref 21.6.1 [snprintf for utility] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                        /* coverity[misra_c_2012_rule_21_6_violation] */
+                        iSnprintfReturnValue = snprintf( pcBuffer,
+                                                         uxBufferLength - uxConsumedBufferLength,
+                                                         "\t%lu\t\t%lu%%\r\n",
+                                                         pxTaskStatus->ulRunTimeCounter,
+                                                         ulStatsAsPercentage );
+                    }
+                    #else /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
+                    {
+                        /* sizeof( int ) == sizeof( long ) so a smaller
+                         * printf() library can be used. */
+                        /* MISRA Ref 21.6.1 [snprintf for utility] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                        /* coverity[misra_c_2012_rule_21_6_violation] */
+                        iSnprintfReturnValue = snprintf( pcBuffer,
+                                                         uxBufferLength - uxConsumedBufferLength,
+                                                         "\t%u\t\t%u%%\r\n",
+                                                         ( unsigned int ) pxTaskStatus->ulRunTimeCounter,
+                                                         ( unsigned int ) ulStatsAsPercentage );
+                    }
+                    #endif /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
+                }
+                else
+                {
+                    /* If the percentage is zero here then the task has
+                     * consumed less than 1% of the total run time. */
+                    #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+                    {
+                        /* MISRA Ref 21.6.1 [snprintf for utility] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                        /* coverity[misra_c_2012_rule_21_6_violation] */
+                        iSnprintfReturnValue = snprintf( pcBuffer,
+                                                         uxBufferLength - uxConsumedBufferLength,
+                                                         "\t%lu\t\t<1%%\r\n",
+                                                         pxTaskStatus->ulRunTimeCounter );
+                    }
+                    #else
+                    {
+                        /* sizeof( int ) == sizeof( long ) so a smaller
+                         * printf() library can be used. */
+                        /* MISRA Ref 21.6.1 [snprintf for utility] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                        /* coverity[misra_c_2012_rule_21_6_violation] */
+                        iSnprintfReturnValue = snprintf( pcBuffer,
+                                                         uxBufferLength - uxConsumedBufferLength,
+                                                         "\t%u\t\t<1%%\r\n",
+                                                         ( unsigned int ) pxTaskStatus->ulRunTimeCounter );
+                    }
+                    #endif /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
+                }
+
+                uxConsumedBufferLength += prvSnprintfReturnValueToCharsWritten( iSnprintfReturnValue, uxBufferLength - uxConsumedBufferLength );
+            }
+            else
+            {
+                *pxBufferFull = pdTRUE;
+            }
+        }
+        else
+        {
+            *pxBufferFull = pdTRUE;
+        }
+
+        return uxConsumedBufferLength;
+    }
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    static List_t * prvGetTaskStatusList( UBaseType_t uxList,
+                                          eTaskState * peState )
+    {
+        List_t * pxList = NULL;
+
+        if( uxList < ( UBaseType_t ) configMAX_PRIORITIES )
+        {
+            /* The ready lists, from the highest priority down. */
+            pxList = &( pxReadyTasksLists[ ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U ) - uxList ] );
+            *peState = eReady;
+        }
+        else if( uxList == ( UBaseType_t ) configMAX_PRIORITIES )
+        {
+            pxList = ( List_t * ) pxDelayedTaskList;
+            *peState = eBlocked;
+        }
+        else if( uxList == ( ( UBaseType_t ) configMAX_PRIORITIES + ( UBaseType_t ) 1U ) )
+        {
+            pxList = ( List_t * ) pxOverflowDelayedTaskList;
+            *peState = eBlocked;
+        }
+        else
+        {
+            #if ( INCLUDE_vTaskDelete == 1 )
+            {
+                if( uxList == ( ( UBaseType_t ) configMAX_PRIORITIES + ( UBaseType_t ) 2U ) )
+                {
+                    pxList = &xTasksWaitingTermination;
+                    *peState = eDeleted;
+                }
+            }
+            #endif
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                if( uxList == ( ( UBaseType_t ) configMAX_PRIORITIES + ( UBaseType_t ) 3U ) )
+                {
+                    pxList = &xSuspendedTaskList;
+                    *peState = eSuspended;
+                }
+            }
+            #endif
+        }
+
+        return pxList;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    static BaseType_t prvGetNextTaskStatus( TaskStatusCursor_t * pxCursor,
+                                            TaskStatus_t * pxTaskStatus,
+                                            configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    {
+        List_t * pxList;
+        ListItem_t * pxNextItem = NULL;
+        TCB_t * pxNextTCB;
+        eTaskState eNextState = eInvalid;
+        UBaseType_t uxIndex;
+        BaseType_t xReturn = pdFALSE;
+
+        vTaskSuspendAll();
+        {
+            /* The ready lists are followed by the two delayed lists, the
+             * termination list and the suspended list.  The last two are
+             * numbered whether or not they exist in this build, so
+             * prvGetTaskStatusList() returning NULL for one of them does not
+             * end the walk. */
+            while( ( pxNextItem == NULL ) && ( pxCursor->uxList <= ( ( UBaseType_t ) configMAX_PRIORITIES + ( UBaseType_t ) 3U ) ) )
+            {
+                pxList = prvGetTaskStatusList( pxCursor->uxList, &eNextState );
+
+                /* Bounding the tasks reported from one list by the number of
+                 * tasks ends the walk even if tasks keep moving onto the list
+                 * ahead of the cursor while the callback runs. */
+                if( ( pxList != NULL ) && ( pxCursor->uxPosition < uxCurrentNumberOfTasks ) )
+                {
+                    if( pxCursor->pxLastItem == NULL )
+                    {
+                        pxNextItem = listGET_HEAD_ENTRY( pxList );
+                    }
+                    else if( ( pxCursor->uxTaskNumber == uxTaskNumber ) &&
+                             ( listLIST_ITEM_CONTAINER( pxCursor->pxLastItem ) == pxList ) )
+                    {
+                        /* No task has been created or deleted, so the saved
+                         * list item is still part of a TCB, and that task has
+                         * not left the list, so carry on from it. */
+                        pxNextItem = listGET_NEXT( pxCursor->pxLastItem );
+                    }
+                    else
+                    {
+                        /* The saved list item cannot be trusted, so skip the
+                         * number of tasks already reported from the list. */
+                        pxNextItem = listGET_HEAD_ENTRY( pxList );
+
+                        for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex < pxCursor->uxPosition ) && ( pxNextItem != listGET_END_MARKER( pxList ) ); uxIndex++ )
+                        {
+                            pxNextItem = listGET_NEXT( pxNextItem );
+                        }
+                    }
+
+                    if( pxNextItem == listGET_END_MARKER( pxList ) )
+                    {
+                        pxNextItem = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( pxNextItem == NULL )
+                {
+                    pxCursor->uxList++;
+                    pxCursor->uxPosition = ( UBaseType_t ) 0U;
+                    pxCursor->pxLastItem = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            if( pxNextItem != NULL )
+            {
+                pxCursor->uxPosition++;
+                pxCursor->pxLastItem = pxNextItem;
+                pxCursor->uxTaskNumber = uxTaskNumber;
+
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxNextTCB = listGET_LIST_ITEM_OWNER( pxNextItem );
+
+                vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, pxTaskStatus, pdTRUE, eNextState );
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                {
+                    if( pulTotalRunTime != NULL )
+                    {
+                        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                            portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+                        #else
+                            *pulTotalRunTime = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+                        #endif
+                    }
+                }
+                #else /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+                {
+                    if( pulTotalRunTime != NULL )
+                    {
+                        *pulTotalRunTime = 0;
+                    }
+                }
+                #endif /* if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
     void vTaskListTasks( char * pcWriteBuffer,
@@ -7299,11 +9530,9 @@ static void prvResetNextTaskUnblockTime( void )
     {
         TaskStatus_t * pxTaskStatusArray;
         size_t uxConsumedBufferLength = 0;
-        size_t uxCharsWrittenBySnprintf;
-        int iSnprintfReturnValue;
+        size_t uxCharsWritten;
         BaseType_t xOutputBufferFull = pdFALSE;
         UBaseType_t uxArraySize, x;
-        char cStatus;
 
         traceENTER_vTaskListTasks( pcWriteBuffer, uxBufferLength );
 
@@ -7357,89 +9586,9 @@ static void prvResetNextTaskUnblockTime( void )
             /* Create a human readable table from the binary data. */
             for( x = 0; x < uxArraySize; x++ )
             {
-                switch( pxTaskStatusArray[ x ].eCurrentState )
-                {
-                    case eRunning:
-                        cStatus = tskRUNNING_CHAR;
-                        break;
-
-                    case eReady:
-                        cStatus = tskREADY_CHAR;
-                        break;
-
-                    case eBlocked:
-                        cStatus = tskBLOCKED_CHAR;
-                        break;
-
-                    case eSuspended:
-                        cStatus = tskSUSPENDED_CHAR;
-                        break;
-
-                    case eDeleted:
-                        cStatus = tskDELETED_CHAR;
-                        break;
-
-                    case eInvalid: /* Fall through. */
-                    default:       /* Should not get here, but it is included
-                                    * to prevent static checking errors. */
-                        cStatus = ( char ) 0x00;
-                        break;
-                }
-
-                /* Is there enough space in the buffer to hold task name? */
-                if( ( uxConsumedBufferLength + configMAX_TASK_NAME_LEN ) <= uxBufferLength )
-                {
-                    /* Write the task name to the string, padding with spaces so it
-                     * can be printed in tabular form more easily. */
-                    pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
-                    /* Do not count the terminating null character. */
-                    uxConsumedBufferLength = uxConsumedBufferLength + ( configMAX_TASK_NAME_LEN - 1U );
-
-                    /* Is there space left in the buffer? -1 is done because snprintf
-                     * writes a terminating null character. So we are essentially
-                     * checking if the buffer has space to write at least one non-null
-                     * character. */
-                    if( uxConsumedBufferLength < ( uxBufferLength - 1U ) )
-                    {
-                        /* Write the rest of the string. */
-                        #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
-                            /* MISRA Ref 21.6.1 [snprintf for utility] */
-                            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
-                            /* coverity[misra_c_2012_rule_21_6_violation] */
-                            iSnprintfReturnValue = snprintf( pcWriteBuffer,
-                                                             uxBufferLength - uxConsumedBufferLength,
-                                                             "\t%c\t%u\t%u\t%u\t0x%x\r\n",
-                                                             cStatus,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].uxCoreAffinityMask );
-                        #else /* ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) ) */
-                            /* MISRA Ref 21.6.1 [snprintf for utility] */
-                            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
-                            /* coverity[misra_c_2012_rule_21_6_violation] */
-                            iSnprintfReturnValue = snprintf( pcWriteBuffer,
-                                                             uxBufferLength - uxConsumedBufferLength,
-                                                             "\t%c\t%u\t%u\t%u\r\n",
-                                                             cStatus,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark,
-                                                             ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber );
-                        #endif /* ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) ) */
-                        uxCharsWrittenBySnprintf = prvSnprintfReturnValueToCharsWritten( iSnprintfReturnValue, uxBufferLength - uxConsumedBufferLength );
-
-                        uxConsumedBufferLength += uxCharsWrittenBySnprintf;
-                        pcWriteBuffer += uxCharsWrittenBySnprintf;
-                    }
-                    else
-                    {
-                        xOutputBufferFull = pdTRUE;
-                    }
-                }
-                else
-                {
-                    xOutputBufferFull = pdTRUE;
-                }
+                uxCharsWritten = prvWriteTaskListRow( pcWriteBuffer, uxBufferLength - uxConsumedBufferLength, &( pxTaskStatusArray[ x ] ), &xOutputBufferFull );
+                uxConsumedBufferLength += uxCharsWritten;
+                pcWriteBuffer += uxCharsWritten;
 
                 if( xOutputBufferFull == pdTRUE )
                 {
@@ -7462,6 +9611,36 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*----------------------------------------------------------*/
 
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    void vTaskListTasksStreaming( TaskStatsRowCallbackFunction_t pxRowCallback,
+                                  void * pvContext )
+    {
+        TaskStatus_t xTaskStatus;
+        char cRowBuffer[ tskSTATS_ROW_BUFFER_LENGTH ];
+        TaskStatusCursor_t xCursor = { ( UBaseType_t ) 0U, ( UBaseType_t ) 0U, NULL, ( UBaseType_t ) 0U };
+        BaseType_t xOutputBufferFull;
+
+        traceENTER_vTaskListTasksStreaming( pxRowCallback, pvContext );
+
+        configASSERT( pxRowCallback != NULL );
+
+        /* Tasks are visited in the same order as vTaskListTasks() reports
+         * them, one task per scheduler suspension, so the callback runs with
+         * the scheduler unsuspended and may block while it outputs the row. */
+        while( prvGetNextTaskStatus( &xCursor, &xTaskStatus, NULL ) != pdFALSE )
+        {
+            xOutputBufferFull = pdFALSE;
+            ( void ) prvWriteTaskListRow( cRowBuffer, sizeof( cRowBuffer ), &xTaskStatus, &xOutputBufferFull );
+            pxRowCallback( cRowBuffer, pvContext );
+        }
+
+        traceRETURN_vTaskListTasksStreaming();
+    }
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*----------------------------------------------------------*/
+
 #if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
 
     void vTaskGetRunTimeStatistics( char * pcWriteBuffer,
@@ -7469,12 +9648,10 @@ static void prvResetNextTaskUnblockTime( void )
     {
         TaskStatus_t * pxTaskStatusArray;
         size_t uxConsumedBufferLength = 0;
-        size_t uxCharsWrittenBySnprintf;
-        int iSnprintfReturnValue;
+        size_t uxCharsWritten;
         BaseType_t xOutputBufferFull = pdFALSE;
         UBaseType_t uxArraySize, x;
         configRUN_TIME_COUNTER_TYPE ulTotalTime = 0;
-        configRUN_TIME_COUNTER_TYPE ulStatsAsPercentage;
 
         traceENTER_vTaskGetRunTimeStatistics( pcWriteBuffer, uxBufferLength );
 
@@ -7532,97 +9709,9 @@ static void prvResetNextTaskUnblockTime( void )
                 /* Create a human readable table from the binary data. */
                 for( x = 0; x < uxArraySize; x++ )
                 {
-                    /* What percentage of the total run time has the task used?
-                     * This will always be rounded down to the nearest integer.
-                     * ulTotalRunTime has already been divided by 100. */
-                    ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
-
-                    /* Is there enough space in the buffer to hold task name? */
-                    if( ( uxConsumedBufferLength + configMAX_TASK_NAME_LEN ) <= uxBufferLength )
-                    {
-                        /* Write the task name to the string, padding with
-                         * spaces so it can be printed in tabular form more
-                         * easily. */
-                        pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
-                        /* Do not count the terminating null character. */
-                        uxConsumedBufferLength = uxConsumedBufferLength + ( configMAX_TASK_NAME_LEN - 1U );
-
-                        /* Is there space left in the buffer? -1 is done because snprintf
-                         * writes a terminating null character. So we are essentially
-                         * checking if the buffer has space to write at least one non-null
-                         * character. */
-                        if( uxConsumedBufferLength < ( uxBufferLength - 1U ) )
-                        {
-                            if( ulStatsAsPercentage > 0U )
-                            {
-                                #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-                                {
-                                    /* MISRA Ref 21.6.1 [snprintf for utility] */
-                                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
-                                    /* coverity[misra_c_2012_rule_21_6_violation] */
-                                    iSnprintfReturnValue = snprintf( pcWriteBuffer,
-                                                                     uxBufferLength - uxConsumedBufferLength,
-                                                                     "\t%lu\t\t%lu%%\r\n",
-                                                                     pxTaskStatusArray[ x ].ulRunTimeCounter,
-                                                                     ulStatsAsPercentage );
-                                }
-                                #else /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
-                                {
-                                    /* sizeof( int ) == sizeof( long ) so a smaller
-                                     * printf() library can be used. */
-                                    /* MISRA Ref 21.6.1 [snprintf for utility] */
-                                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
-                                    /* coverity[misra_c_2012_rule_21_6_violation] */
-                                    iSnprintfReturnValue = snprintf( pcWriteBuffer,
-                                                                     uxBufferLength - uxConsumedBufferLength,
-                                                                     "\t%u\t\t%u%%\r\n",
-                                                                     ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter,
-                                                                     ( unsigned int ) ulStatsAsPercentage );
-                                }
-                                #endif /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
-                            }
-                            else
-                            {
-                                /* If the percentage is zero here then the task has
-                                 * consumed less than 1% of the total run time. */
-                                #ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-                                {
-                                    /* MISRA Ref 21.6.1 [snprintf for utility] */
-                                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
-                                    /* coverity[misra_c_2012_rule_21_6_violation] */
-                                    iSnprintfReturnValue = snprintf( pcWriteBuffer,
-                                                                     uxBufferLength - uxConsumedBufferLength,
-                                                                     "\t%lu\t\t<1%%\r\n",
-                                                                     pxTaskStatusArray[ x ].ulRunTimeCounter );
-                                }
-                                #else
-                                {
-                                    /* sizeof( int ) == sizeof( long ) so a smaller
-                                     * printf() library can be used. */
-                                    /* MISRA Ref 21.6.1 [snprintf for utility] */
-                                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
-                                    /* coverity[misra_c_2012_rule_21_6_violation] */
-                                    iSnprintfReturnValue = snprintf( pcWriteBuffer,
-                                                                     uxBufferLength - uxConsumedBufferLength,
-                                                                     "\t%u\t\t<1%%\r\n",
-                                                                     ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter );
-                                }
-                                #endif /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
-                            }
-
-                            uxCharsWrittenBySnprintf = prvSnprintfReturnValueToCharsWritten( iSnprintfReturnValue, uxBufferLength - uxConsumedBufferLength );
-                            uxConsumedBufferLength += uxCharsWrittenBySnprintf;
-                            pcWriteBuffer += uxCharsWrittenBySnprintf;
-                        }
-                        else
-                        {
-                            xOutputBufferFull = pdTRUE;
-                        }
-                    }
-                    else
-                    {
-                        xOutputBufferFull = pdTRUE;
-                    }
+                    uxCharsWritten = prvWriteRunTimeStatsRow( pcWriteBuffer, uxBufferLength - uxConsumedBufferLength, &( pxTaskStatusArray[ x ] ), ulTotalTime, &xOutputBufferFull );
+                    uxConsumedBufferLength += uxCharsWritten;
+                    pcWriteBuffer += uxCharsWritten;
 
                     if( xOutputBufferFull == pdTRUE )
                     {
@@ -7650,13 +9739,63 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
-TickType_t uxTaskResetEventItemValue( void )
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+
+    void vTaskGetRunTimeStatisticsStreaming( TaskStatsRowCallbackFunction_t pxRowCallback,
+                                             void * pvContext )
+    {
+        TaskStatus_t xTaskStatus;
+        char cRowBuffer[ tskSTATS_ROW_BUFFER_LENGTH ];
+        TaskStatusCursor_t xCursor = { ( UBaseType_t ) 0U, ( UBaseType_t ) 0U, NULL, ( UBaseType_t ) 0U };
+        BaseType_t xOutputBufferFull;
+        configRUN_TIME_COUNTER_TYPE ulTotalTime = 0;
+
+        traceENTER_vTaskGetRunTimeStatisticsStreaming( pxRowCallback, pvContext );
+
+        configASSERT( pxRowCallback != NULL );
+
+        /* As vTaskListTasksStreaming(), but the total run time is sampled
+         * together with each task's counter so the percentage on every row is
+         * consistent even if the callback blocks between rows. */
+        while( prvGetNextTaskStatus( &xCursor, &xTaskStatus, &ulTotalTime ) != pdFALSE )
+        {
+            /* For percentage calculations. */
+            ulTotalTime /= ( ( configRUN_TIME_COUNTER_TYPE ) 100U );
+
+            /* Avoid divide by zero errors. */
+            if( ulTotalTime > 0U )
+            {
+                xOutputBufferFull = pdFALSE;
+                ( void ) prvWriteRunTimeStatsRow( cRowBuffer, sizeof( cRowBuffer ), &xTaskStatus, ulTotalTime, &xOutputBufferFull );
+                pxRowCallback( cRowBuffer, pvContext );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_vTaskGetRunTimeStatisticsStreaming();
+    }
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+EventItemValue_t uxTaskResetEventItemValue( void )
 {
-    TickType_t uxReturn;
+    EventItemValue_t uxReturn;
 
     traceENTER_uxTaskResetEventItemValue();
 
-    uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+    #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+    {
+        uxReturn = pxCurrentTCB->xEventItemValue;
+    }
+    #else
+    {
+        uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+    }
+    #endif
 
     /* Reset the event list item to its normal value - so it can be used with
      * queues and semaphores. */
@@ -7668,6 +9807,31 @@ TickType_t uxTaskResetEventItemValue( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+
+    EventItemValue_t uxTaskGetEventItemValue( const ListItem_t * pxEventListItem )
+    {
+        const TCB_t * pxTCB;
+        EventItemValue_t uxReturn;
+
+        traceENTER_uxTaskGetEventItemValue( pxEventListItem );
+
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        pxTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+        configASSERT( pxTCB );
+
+        uxReturn = pxTCB->xEventItemValue;
+
+        traceRETURN_uxTaskGetEventItemValue( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* #if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_MUTEXES == 1 )
 
     TaskHandle_t pvTaskIncrementMutexHeldCount( void )
@@ -7682,6 +9846,13 @@ TickType_t uxTaskResetEventItemValue( void )
          * then pxCurrentTCB will be NULL. */
         if( pxTCB != NULL )
         {
+            #if ( configUSE_COMPACT_TCB == 1 )
+            {
+                /* The count is held in a byte. */
+                configASSERT( pxTCB->uxMutexesHeld < ( taskTCB_UNSIGNED_TYPE ) 0xFFU );
+            }
+            #endif
+
             ( pxTCB->uxMutexesHeld )++;
         }
 
@@ -8343,6 +10514,207 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    BaseType_t xTaskNotifyMultipleFromISR( const TaskNotifyTarget_t * pxTargets,
+                                           UBaseType_t uxNumberOfTargets,
+                                           BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        TCB_t * pxTCB;
+        const TaskNotifyTarget_t * pxTarget;
+        UBaseType_t uxTarget;
+        UBaseType_t uxIndexToNotify;
+        uint8_t ucOriginalNotifyState;
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxSavedInterruptStatus;
+
+        #if ( configNUMBER_OF_CORES == 1 )
+            const TCB_t * pxHighestPriorityTaskWoken = NULL;
+        #endif
+
+        traceENTER_xTaskNotifyMultipleFromISR( pxTargets, uxNumberOfTargets, pxHigherPriorityTaskWoken );
+
+        configASSERT( ( pxTargets != NULL ) || ( uxNumberOfTargets == ( UBaseType_t ) 0U ) );
+
+        /* See the comment in xTaskGenericNotifyFromISR() regarding the maximum
+         * system call interrupt priority. */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            for( uxTarget = ( UBaseType_t ) 0U; uxTarget < uxNumberOfTargets; uxTarget++ )
+            {
+                pxTarget = &( pxTargets[ uxTarget ] );
+                pxTCB = pxTarget->xTaskToNotify;
+                uxIndexToNotify = pxTarget->uxIndexToNotify;
+
+                configASSERT( pxTCB );
+                configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+                ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+                pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
+
+                switch( pxTarget->eAction )
+                {
+                    case eSetBits:
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= pxTarget->ulValue;
+                        break;
+
+                    case eIncrement:
+                        ( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+                        break;
+
+                    case eSetValueWithOverwrite:
+                        pxTCB->ulNotifiedValue[ uxIndexToNotify ] = pxTarget->ulValue;
+                        break;
+
+                    case eSetValueWithoutOverwrite:
+
+                        if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+                        {
+                            pxTCB->ulNotifiedValue[ uxIndexToNotify ] = pxTarget->ulValue;
+                        }
+                        else
+                        {
+                            /* The value could not be written to this task, but
+                             * the rest of the batch is still sent. */
+                            xReturn = pdFAIL;
+                        }
+
+                        break;
+
+                    case eNoAction:
+
+                        /* The task is being notified without its notify value
+                         * being updated. */
+                        break;
+
+                    default:
+
+                        /* Should not get here if all enums are handled.
+                         * Artificially force an assert by testing a value the
+                         * compiler can't assume is const. */
+                        configASSERT( xTickCount == ( TickType_t ) 0 );
+                        break;
+                }
+
+                traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify );
+
+                /* If the task is in the blocked state specifically to wait for a
+                 * notification then unblock it now. */
+                if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+                {
+                    /* The task should not have been on an event list. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+                    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                        prvAddTaskToReadyList( pxTCB );
+                    }
+                    else
+                    {
+                        /* The delayed and ready lists cannot be accessed, so hold
+                         * this task pending until the scheduler is resumed. */
+                        listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                    }
+
+                    #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        /* Only remember the highest priority task unblocked by
+                         * the batch - the yield decision is made once below. */
+                        if( ( pxHighestPriorityTaskWoken == NULL ) ||
+                            ( pxTCB->uxPriority > pxHighestPriorityTaskWoken->uxPriority ) )
+                        {
+                            pxHighestPriorityTaskWoken = pxTCB;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+                    {
+                        #if ( configUSE_PREEMPTION == 1 )
+                        {
+                            /* prvYieldForTask() does not select a core that has
+                             * already been requested to yield, so each core
+                             * receives at most one yield request for the whole
+                             * batch. */
+                            prvYieldForTask( pxTCB );
+                        }
+                        #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+                    }
+                    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            #if ( configUSE_TICKLESS_IDLE != 0 )
+            {
+                /* See the comment in xTaskGenericNotifyFromISR().  The next
+                 * unblock time only needs resetting once for the whole batch. */
+                if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+                {
+                    prvResetNextTaskUnblockTime();
+                }
+            }
+            #endif
+
+            #if ( configNUMBER_OF_CORES == 1 )
+            {
+                if( ( pxHighestPriorityTaskWoken != NULL ) &&
+                    ( pxHighestPriorityTaskWoken->uxPriority > pxCurrentTCB->uxPriority ) )
+                {
+                    /* A notified task has a priority above the currently
+                     * executing task so a yield is required. */
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+
+                    /* Mark that a yield is pending in case the user is not
+                     * using the "xHigherPriorityTaskWoken" parameter to an ISR
+                     * safe FreeRTOS function. */
+                    xYieldPendings[ 0 ] = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            {
+                #if ( configUSE_PREEMPTION == 1 )
+                {
+                    if( xYieldPendings[ portGET_CORE_ID() ] == pdTRUE )
+                    {
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                    }
+                }
+                #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+            }
+            #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xTaskNotifyMultipleFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
     BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask,
@@ -8600,6 +10972,22 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
     }
     #endif
 
+    #if ( configUSE_DEADLOCK_DETECTION == 1 )
+    {
+        /* Start timing a new wait, which has not been reported yet. */
+        pxCurrentTCB->xBlockedSince = xConstTickCount;
+        pxCurrentTCB->ucBlockingReported = ( uint8_t ) 0U;
+    }
+    #endif
+
+    #if ( configUSE_TIME_SLICE_LENGTH == 1 )
+    {
+        /* The task gives up the rest of its time slice by blocking, so it
+         * starts a full time slice when it next runs. */
+        pxCurrentTCB->xTimeSliceRemaining = pxCurrentTCB->xTimeSliceLength;
+    }
+    #endif
+
     /* Remove the task from the ready list before adding it to the blocked list
      * as the same list item is used for both lists. */
     if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
@@ -8864,5 +11252,12 @@ void vTaskResetState( void )
         }
     }
     #endif /* #if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) )
+    {
+        ( void ) memset( ( void * ) xKernelLockHolders, 0x00, sizeof( xKernelLockHolders ) );
+        ( void ) memset( ( void * ) xLockStatistics, 0x00, sizeof( xLockStatistics ) );
+    }
+    #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SMP_LOCK_STATISTICS == 1 ) ) */
 }
 /*-----------------------------------------------------------*/
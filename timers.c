@@ -157,6 +157,14 @@
  */
     static void prvCheckForValidListAndQueue( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Adds each timer in pxList to a snapshot being written by xTaskWriteSnapshot().
+ */
+    #if ( configUSE_KERNEL_SNAPSHOT == 1 )
+        static void prvWriteTimerListSnapshot( SnapshotWriter_t * pxWriter,
+                                               const List_t * pxList ) PRIVILEGED_FUNCTION;
+    #endif
+
 /*
  * The timer service task (daemon).  Timer functionality is controlled by this
  * task.  Other tasks communicate with the timer service task using the
@@ -1337,6 +1345,69 @@
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+        void vTimerWriteSnapshot( SnapshotWriter_t * pxWriter )
+        {
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xActiveTimerList1, sizeof( xActiveTimerList1 ) );
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xActiveTimerList2, sizeof( xActiveTimerList2 ) );
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &pxCurrentTimerList, sizeof( pxCurrentTimerList ) );
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &pxOverflowTimerList, sizeof( pxOverflowTimerList ) );
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xTimerQueue, sizeof( xTimerQueue ) );
+            vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_KERNEL, &xTimerTaskHandle, sizeof( xTimerTaskHandle ) );
+
+            /* The lists are not initialised until the first timer is created
+             * or the scheduler is started. */
+            if( xTimerQueue != NULL )
+            {
+                prvWriteTimerListSnapshot( pxWriter, pxCurrentTimerList );
+                prvWriteTimerListSnapshot( pxWriter, pxOverflowTimerList );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* configUSE_KERNEL_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_KERNEL_SNAPSHOT == 1 )
+
+        static void prvWriteTimerListSnapshot( SnapshotWriter_t * pxWriter,
+                                               const List_t * pxList )
+        {
+            const ListItem_t * pxListItem = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t * const pxListEnd = listGET_END_MARKER( pxList );
+            UBaseType_t uxRemaining = listCURRENT_LIST_LENGTH( pxList );
+            const Timer_t * pxTimer;
+
+            /* The walk is bounded by the length of the list, so a corrupted
+             * list cannot be followed indefinitely. */
+            while( ( pxListItem != pxListEnd ) && ( pxListItem != NULL ) && ( uxRemaining > ( UBaseType_t ) 0U ) )
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTimer = listGET_LIST_ITEM_OWNER( pxListItem );
+
+                /* A list item without an owner can only be found in a
+                 * corrupted list, so nothing after it can be trusted. */
+                if( pxTimer == NULL )
+                {
+                    break;
+                }
+
+                vTaskSnapshotWriteMemory( pxWriter, tskSNAPSHOT_MEMORY_TIMER, pxTimer, sizeof( Timer_t ) );
+
+                pxListItem = listGET_NEXT( pxListItem );
+                uxRemaining--;
+            }
+        }
+
+    #endif /* configUSE_KERNEL_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
 /* This entire source file will be skipped if the application is not configured
  * to include software timer functionality.  If you want to include software timer
  * functionality then ensure configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */